@@ -9,10 +9,18 @@ ControlPanel::ControlPanel(juce::AudioProcessorValueTreeState& vts)
     filterTypeBox.addItem("Bandpass", 3);
     filterTypeBox.addItem("Notch", 4);
     filterTypeBox.addItem("Off", 5);
+    filterTypeBox.addItem("Ladder", 6);
     addAndMakeVisible(filterTypeBox);
     filterTypeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
         apvts, "filterType", filterTypeBox);
     
+    filterDriveModeBox.addItem("Tanh", 1);
+    filterDriveModeBox.addItem("Asymmetric", 2);
+    filterDriveModeBox.addItem("Hard Clip", 3);
+    addAndMakeVisible(filterDriveModeBox);
+    filterDriveModeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        apvts, "filterDriveMode", filterDriveModeBox);
+    
     // Filter parameters
     filterCutoffSlider = createRotarySlider("filterCutoff");
     filterCutoffLabel = createLabel("Cutoff", filterCutoffSlider.get());
@@ -149,6 +157,7 @@ void ControlPanel::resized()
     
     auto filterRow1 = filterSection.removeFromTop(40);
     filterTypeBox.setBounds(filterRow1.removeFromLeft(120).reduced(5));
+    filterDriveModeBox.setBounds(filterRow1.removeFromLeft(120).reduced(5));
     
     auto filterRow2 = filterSection.removeFromTop(80);
     int knobSize = 60;
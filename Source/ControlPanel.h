@@ -28,6 +28,9 @@ private:
     juce::ComboBox filterTypeBox;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> filterTypeAttachment;
     
+    juce::ComboBox filterDriveModeBox;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> filterDriveModeAttachment;
+    
     std::unique_ptr<juce::Slider> filterCutoffSlider;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> filterCutoffAttachment;
     std::unique_ptr<juce::Label> filterCutoffLabel;
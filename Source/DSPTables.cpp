@@ -0,0 +1,238 @@
+#include "DSPTables.h"
+#include <cstddef>
+#include <utility>
+
+// The tables are constant expressions evaluated here, once, rather than in
+// every translation unit that reads them.
+namespace DSPTables {
+
+
+constexpr double pi = 3.14159265358979323846;
+constexpr double ln2 = 0.69314718055994530942;
+
+//==============================================================================
+// constexpr math. Arguments are range-reduced first, so fixed-length series
+// are exact to double precision.
+
+constexpr double roundToInt(double x)
+{
+    return static_cast<double>(static_cast<long long>(x < 0.0 ? x - 0.5 : x + 0.5));
+}
+
+constexpr double sin(double x)
+{
+    // Reduce to [-pi, pi], then fold to [-pi/2, pi/2]
+    x -= 2.0 * pi * roundToInt(x / (2.0 * pi));
+    if (x > 0.5 * pi) x = pi - x;
+    if (x < -0.5 * pi) x = -pi - x;
+    
+    const double x2 = x * x;
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 14; n++)
+    {
+        term *= -x2 / double((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double exp(double x)
+{
+    // x = k ln2 + r with |r| <= ln2 / 2
+    const double k = roundToInt(x / ln2);
+    const double r = x - k * ln2;
+    
+    double term = 1.0;
+    double sum = 1.0;
+    for (int n = 1; n < 20; n++)
+    {
+        term *= r / double(n);
+        sum += term;
+    }
+    
+    for (int i = 0; i < static_cast<int>(k); i++) sum *= 2.0;
+    for (int i = 0; i < -static_cast<int>(k); i++) sum *= 0.5;
+    return sum;
+}
+
+constexpr double tanh(double x)
+{
+    return 1.0 - 2.0 / (exp(2.0 * x) + 1.0);
+}
+
+//==============================================================================
+// One period of sin(2 pi i / Size). Integer harmonics and the cosine are read
+// from it by index, so derived tables need no further transcendental calls.
+template <int Size>
+constexpr std::array<double, Size> makeSineCycle()
+{
+    std::array<double, Size> cycle {};
+    for (int i = 0; i < Size; i++)
+    {
+        cycle[i] = sin(2.0 * pi * double(i) / double(Size));
+    }
+    return cycle;
+}
+
+//==============================================================================
+// Morphing wavetables
+
+constexpr auto wavetableSineCycle = makeSineCycle<WAVETABLE_SIZE>();
+
+constexpr Wavetable makeWavetable(int table)
+{
+    Wavetable result {};
+    for (int i = 0; i < WAVETABLE_SIZE; i++)
+    {
+        double sum = 0.0;
+        for (int h = 1; h <= table + 1; h++)
+        {
+            const double amplitude = 1.0 / (h * (1.0 + table * 0.1));
+            sum += wavetableSineCycle[(h * i) % WAVETABLE_SIZE] * amplitude;
+        }
+        result[i] = static_cast<float>(tanh(sum * 0.5));
+    }
+    return result;
+}
+
+// Each table is its own constant so no single evaluation hits the
+// compiler's constexpr step limit
+template <int Table>
+constexpr Wavetable wavetable = makeWavetable(Table);
+
+template <std::size_t... Tables>
+constexpr std::array<const float*, sizeof...(Tables)> makeWavetableSet(std::index_sequence<Tables...>)
+{
+    return { wavetable<static_cast<int>(Tables)>.data()... };
+}
+
+constexpr std::array<const float*, NUM_WAVETABLES> wavetables =
+    makeWavetableSet(std::make_index_sequence<NUM_WAVETABLES>());
+
+//==============================================================================
+// Periodic Hann window for the STFT
+template <int Size>
+constexpr std::array<float, Size> makeHannWindow()
+{
+    constexpr auto cycle = makeSineCycle<Size>();
+    std::array<float, Size> window {};
+    for (int i = 0; i < Size; i++)
+    {
+        const double cosine = cycle[(i + Size / 4) % Size];
+        window[i] = static_cast<float>(0.5 - 0.5 * cosine);
+    }
+    return window;
+}
+
+constexpr std::array<float, SPECTRAL_WINDOW_SIZE> spectralWindow = makeHannWindow<SPECTRAL_WINDOW_SIZE>();
+
+// Sine with a guard point, for table oscillators that interpolate linearly
+
+constexpr std::array<float, SINE_TABLE_SIZE + 1> makeSineTable()
+{
+    constexpr auto cycle = makeSineCycle<SINE_TABLE_SIZE>();
+    std::array<float, SINE_TABLE_SIZE + 1> table {};
+    for (int i = 0; i <= SINE_TABLE_SIZE; i++)
+    {
+        table[i] = static_cast<float>(cycle[i % SINE_TABLE_SIZE]);
+    }
+    return table;
+}
+
+constexpr std::array<float, SINE_TABLE_SIZE + 1> sineTable = makeSineTable();
+
+// Polyphase decimators
+
+template <int Factor>
+constexpr std::array<float, Factor * DECIMATOR_BRANCH_TAPS> makeDecimator()
+{
+    constexpr int length = Factor * DECIMATOR_BRANCH_TAPS;
+    const double cutoff = 0.45 / Factor; // Cycles per oversampled sample
+    std::array<double, length> prototype {};
+    double sum = 0.0;
+    
+    for (int i = 0; i < length; i++)
+    {
+        // Even length, so the centre falls between taps and x is never zero
+        const double x = 2.0 * pi * cutoff * (i - 0.5 * (length - 1));
+        const double w = 2.0 * pi * i / (length - 1);
+        const double window = 0.42 - 0.5 * sin(w + 0.5 * pi) + 0.08 * sin(2.0 * w + 0.5 * pi);
+        prototype[i] = sin(x) / x * window;
+        sum += prototype[i];
+    }
+    
+    // Branch p holds taps p, p + Factor, p + 2 Factor...
+    std::array<float, length> table {};
+    for (int p = 0; p < Factor; p++)
+    {
+        for (int k = 0; k < DECIMATOR_BRANCH_TAPS; k++)
+            table[p * DECIMATOR_BRANCH_TAPS + k] = static_cast<float>(prototype[k * Factor + p] / sum);
+    }
+    return table;
+}
+
+constexpr std::array<float, 2 * DECIMATOR_BRANCH_TAPS> decimator2x = makeDecimator<2>();
+constexpr std::array<float, 4 * DECIMATOR_BRANCH_TAPS> decimator4x = makeDecimator<4>();
+
+// True-peak interpolator
+
+constexpr std::array<float, TRUE_PEAK_OVERSAMPLING * TRUE_PEAK_TAPS> makeTruePeakInterpolator()
+{
+    constexpr int length = TRUE_PEAK_OVERSAMPLING * TRUE_PEAK_TAPS;
+    std::array<double, length> prototype {};
+    double sum = 0.0;
+    
+    for (int i = 0; i < length; i++)
+    {
+        // Even length, so the centre falls between taps and x is never zero
+        const double x = pi * (i - 0.5 * (length - 1)) / TRUE_PEAK_OVERSAMPLING;
+        const double w = 2.0 * pi * i / (length - 1);
+        const double window = 0.42 - 0.5 * sin(w + 0.5 * pi) + 0.08 * sin(2.0 * w + 0.5 * pi);
+        prototype[i] = sin(x) / x * window;
+        sum += prototype[i];
+    }
+    
+    // Each branch passes DC at unity
+    std::array<float, length> table {};
+    for (int i = 0; i < length; i++)
+    {
+        table[i] = static_cast<float>(prototype[i] * TRUE_PEAK_OVERSAMPLING / sum);
+    }
+    return table;
+}
+
+alignas(16) constexpr std::array<float, TRUE_PEAK_OVERSAMPLING * TRUE_PEAK_TAPS> truePeakInterpolator =
+    makeTruePeakInterpolator();
+
+// Mallet pulse
+constexpr std::array<float, MALLET_LENGTH> malletPulse = makeHannWindow<MALLET_LENGTH>();
+
+//==============================================================================
+// Cloud Nine grain source
+
+constexpr std::array<float, GRAIN_BUFFER_SIZE> makeGrainBuffer()
+{
+    constexpr auto cycle = makeSineCycle<GRAIN_BUFFER_SIZE>();
+    
+    // exp(-3t) on a uniform grid is a geometric sequence
+    const double decayPerSample = exp(-3.0 / GRAIN_BUFFER_SIZE);
+    double decay = 1.0;
+    
+    std::array<float, GRAIN_BUFFER_SIZE> buffer {};
+    for (int i = 0; i < GRAIN_BUFFER_SIZE; i++)
+    {
+        const double t = double(i) / GRAIN_BUFFER_SIZE;
+        double value = cycle[i] * 0.5
+                     + cycle[(2 * i) % GRAIN_BUFFER_SIZE] * 0.25
+                     + cycle[(3 * i) % GRAIN_BUFFER_SIZE] * 0.125;
+        value *= decay * (1.0 - t);
+        buffer[i] = static_cast<float>(value);
+        decay *= decayPerSample;
+    }
+    return buffer;
+}
+
+constexpr std::array<float, GRAIN_BUFFER_SIZE> grainBuffer = makeGrainBuffer();
+
+} // namespace DSPTables
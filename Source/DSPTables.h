@@ -0,0 +1,52 @@
+#pragma once
+
+#include <array>
+
+// Read-only DSP tables generated at compile time. They are evaluated once,
+// in DSPTables.cpp, and live in the binary's read-only data; engines
+// reference them directly instead of building them at load.
+namespace DSPTables {
+
+//==============================================================================
+// Morphing wavetables: table t holds harmonics 1..t+1 with a natural rolloff,
+// normalised with a soft knee.
+constexpr int WAVETABLE_SIZE = 2048;
+constexpr int NUM_WAVETABLES = 16;
+using Wavetable = std::array<float, WAVETABLE_SIZE>;
+
+extern const std::array<const float*, NUM_WAVETABLES> wavetables;
+
+//==============================================================================
+// Periodic Hann window for the STFT
+constexpr int SPECTRAL_WINDOW_SIZE = 2048;
+extern const std::array<float, SPECTRAL_WINDOW_SIZE> spectralWindow;
+
+// Sine with a guard point, for table oscillators that interpolate linearly
+constexpr int SINE_TABLE_SIZE = 2048;
+extern const std::array<float, SINE_TABLE_SIZE + 1> sineTable;
+
+// Decimation lowpass for oversampled cores: a Blackman-windowed sinc cut
+// off just below the host Nyquist. Stored branch-major for polyphase
+// decimation, so each branch's taps are contiguous.
+constexpr int DECIMATOR_BRANCH_TAPS = 24;
+extern const std::array<float, 2 * DECIMATOR_BRANCH_TAPS> decimator2x;
+extern const std::array<float, 4 * DECIMATOR_BRANCH_TAPS> decimator4x;
+
+// True-peak interpolator: a 48-tap Blackman-windowed sinc split into four
+// polyphase branches, as in ITU-R BS.1770. Stored tap-major and aligned, so
+// one tap of every branch loads as a single SIMD register.
+constexpr int TRUE_PEAK_OVERSAMPLING = 4;
+constexpr int TRUE_PEAK_TAPS = 12; // Per branch
+alignas(16) extern const std::array<float, TRUE_PEAK_OVERSAMPLING * TRUE_PEAK_TAPS> truePeakInterpolator;
+
+// Force pulse of a soft mallet striking the modal resonators, about 0.7 ms.
+// Its rolloff softens the highest modes the way a felt head does.
+constexpr int MALLET_LENGTH = 32;
+extern const std::array<float, MALLET_LENGTH> malletPulse;
+
+//==============================================================================
+// Grain source for Cloud Nine: three harmonics under a decaying envelope
+constexpr int GRAIN_BUFFER_SIZE = 8192;
+extern const std::array<float, GRAIN_BUFFER_SIZE> grainBuffer;
+
+} // namespace DSPTables
@@ -4,9 +4,6 @@
 EnhancedVisualizer::EnhancedVisualizer(juce::AudioProcessorValueTreeState& apvts)
     : parameters(apvts)
 {
-    // Initialize mode tables
-    squareModes = CymaglyphModes::getSquareModes();
-    
     // Initialize grain field
     for (int i = 0; i < GRID_SIZE; i++)
     {
@@ -181,14 +178,14 @@ void EnhancedVisualizer::updateModeParameters(float frequency)
 {
     // Calculate Chladni pattern modes based on frequency
     float rank = CymaglyphModes::frequencyToModeRank(frequency);
-    auto modePair = CymaglyphModes::getModePair(squareModes, rank);
+    auto modePair = CymaglyphModes::getModePair(CymaglyphModes::squareModeTable, rank);
     
     modeParams.mode1_m = modePair.first.m;
     modeParams.mode1_n = modePair.first.n;
     modeParams.mode2_m = modePair.second.m;
     modeParams.mode2_n = modePair.second.n;
     
-    modeParams.modeCrossfade = CymaglyphModes::getModeCrossfade(rank, squareModes.size());
+    modeParams.modeCrossfade = CymaglyphModes::getModeCrossfade(rank, CymaglyphModes::NUM_SQUARE_MODES);
 }
 
 void EnhancedVisualizer::updateGrainField()
@@ -71,9 +71,6 @@ private:
     // Parameters
     juce::AudioProcessorValueTreeState& parameters;
     
-    // Mode data
-    std::vector<CymaglyphModes::SquareMode> squareModes;
-    
     // Current mode parameters
     struct ModeParams {
         int mode1_m = 1, mode1_n = 1;
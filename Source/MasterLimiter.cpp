@@ -0,0 +1,123 @@
+#include "MasterLimiter.h"
+#include <algorithm>
+#include <cmath>
+
+void MasterLimiter::prepare(double sampleRate)
+{
+    // 1.5 ms lookahead, 50 ms release
+    lookahead = juce::jlimit(8, maxLookahead, static_cast<int>(std::round(sampleRate * 0.0015)));
+    releaseCoefficient = static_cast<float>(std::exp(-1.0 / (0.05 * sampleRate)));
+    reset();
+}
+
+void MasterLimiter::reset()
+{
+    leftHistory.fill(0.0f);
+    rightHistory.fill(0.0f);
+    historyIndex = 0;
+    
+    minimumFront = 0;
+    minimumCount = 0;
+    sampleCounter = 0;
+    
+    releasedGain = 1.0f;
+    rampHistory.fill(1.0f);
+    rampSum = lookahead;
+    rampIndex = 0;
+    
+    delayLine.fill(StereoFrame<double>());
+    delayIndex = 0;
+}
+
+float MasterLimiter::truePeak(float left, float right)
+{
+    using Register = juce::dsp::SIMDRegister<float>;
+    constexpr int width = static_cast<int>(Register::SIMDNumElements);
+    static_assert(oversampling % width == 0);
+    
+    // Newest first: history[historyIndex + k] is k samples old
+    historyIndex = (historyIndex + taps - 1) % taps;
+    leftHistory[historyIndex] = leftHistory[historyIndex + taps] = left;
+    rightHistory[historyIndex] = rightHistory[historyIndex + taps] = right;
+    
+    // Every polyphase branch at once, one lane each
+    alignas(16) std::array<float, oversampling> peaks;
+    for (int branch = 0; branch < oversampling; branch += width)
+    {
+        Register leftSum(0.0f);
+        Register rightSum(0.0f);
+        for (int k = 0; k < taps; k++)
+        {
+            const auto c = Register::fromRawArray(interpolator.data() + k * oversampling + branch);
+            leftSum += c * leftHistory[historyIndex + k];
+            rightSum += c * rightHistory[historyIndex + k];
+        }
+        Register::max(Register::abs(leftSum), Register::abs(rightSum)).copyToRawArray(peaks.data() + branch);
+    }
+    
+    return *std::max_element(peaks.begin(), peaks.end());
+}
+
+float MasterLimiter::holdMinimum(float gain)
+{
+    // Queued gains the new one undercuts can never be the minimum again
+    while (minimumCount > 0 && minimumValues[(minimumFront + minimumCount - 1) & ringMask] >= gain)
+        minimumCount--;
+    
+    const int back = (minimumFront + minimumCount) & ringMask;
+    minimumValues[back] = gain;
+    minimumTimes[back] = sampleCounter;
+    minimumCount++;
+    
+    // Held one sample past the lookahead: an interpolated peak lies between
+    // two input samples and both must be covered
+    while (sampleCounter - minimumTimes[minimumFront] > static_cast<uint32_t>(lookahead))
+    {
+        minimumFront = (minimumFront + 1) & ringMask;
+        minimumCount--;
+    }
+    
+    sampleCounter++;
+    return minimumValues[minimumFront];
+}
+
+template <typename SampleType>
+void MasterLimiter::process(StereoFrame<SampleType>* frames, int numFrames)
+{
+    jassert(numFrames <= maxBlockSize);
+    std::array<float, maxBlockSize> gains;
+    
+    // Gain each sample's true peak needs
+    for (int i = 0; i < numFrames; i++)
+    {
+        const float peak = truePeak(static_cast<float>(frames[i].left), static_cast<float>(frames[i].right));
+        gains[i] = peak > ceiling ? ceiling / peak : 1.0f;
+    }
+    
+    // Hold, release, then ramp in with a moving average over the lookahead.
+    // Every gain averaged is at or below the held minimum, so the ramp reaches
+    // each peak's gain by the time the peak leaves the delay.
+    for (int i = 0; i < numFrames; i++)
+    {
+        const float held = holdMinimum(gains[i]);
+        releasedGain = held < releasedGain ? held : held + (releasedGain - held) * releaseCoefficient;
+        
+        rampSum += releasedGain - rampHistory[(rampIndex - lookahead) & ringMask];
+        rampHistory[rampIndex] = releasedGain;
+        rampIndex = (rampIndex + 1) & ringMask;
+        gains[i] = static_cast<float>(rampSum / lookahead);
+    }
+    
+    const int latency = getLatencySamples();
+    for (int i = 0; i < numFrames; i++)
+    {
+        delayLine[delayIndex] = StereoFrame<double>(frames[i]);
+        const auto delayed = delayLine[(delayIndex - latency) & ringMask];
+        delayIndex = (delayIndex + 1) & ringMask;
+        
+        frames[i] = StereoFrame<SampleType>(delayed * StereoFrame<double>(gains[i]));
+    }
+}
+
+template void MasterLimiter::process<float>(StereoFrame<float>* frames, int numFrames);
+template void MasterLimiter::process<double>(StereoFrame<double>* frames, int numFrames);
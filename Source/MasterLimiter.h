@@ -0,0 +1,64 @@
+#pragma once
+
+#include "SynthEngine.h"
+#include <array>
+#include <cstdint>
+
+// Lookahead limiter for the master bus. Peaks are measured on a 4x
+// oversampled copy of the signal, so inter-sample peaks count too. The gain
+// reduction is computed a block at a time: each block's gains are held
+// across the lookahead, released, and ramped into with a moving average.
+// The audio is delayed so the ramp is complete before the peak that caused
+// it plays. Both channels share one gain.
+class MasterLimiter
+{
+public:
+    static constexpr int maxBlockSize = 32;
+    static constexpr float ceiling = 0.891251f; // -1 dBTP
+    
+    void prepare(double sampleRate);
+    void reset();
+    
+    // Limits up to maxBlockSize frames in place
+    template <typename SampleType>
+    void process(StereoFrame<SampleType>* frames, int numFrames);
+    
+    int getLatencySamples() const { return lookahead - 1 + detectorDelay; }
+    
+private:
+    static constexpr int oversampling = DSPTables::TRUE_PEAK_OVERSAMPLING;
+    static constexpr int taps = DSPTables::TRUE_PEAK_TAPS;
+    static constexpr int detectorDelay = taps / 2; // Input samples the interpolator lags by
+    static constexpr int maxLookahead = 256;
+    static constexpr int ringSize = 512;           // Power of two above maxLookahead + detectorDelay
+    static constexpr int ringMask = ringSize - 1;
+    
+    // Read a SIMD register at a time
+    static constexpr const auto& interpolator = DSPTables::truePeakInterpolator;
+    
+    float truePeak(float left, float right);
+    float holdMinimum(float gain);
+    
+    int lookahead = 64;
+    float releaseCoefficient = 0.9995f;
+    
+    // Interpolator input, stored twice so every read is one contiguous run
+    std::array<float, taps * 2> leftHistory {};
+    std::array<float, taps * 2> rightHistory {};
+    int historyIndex = 0;
+    
+    // Sliding minimum over the lookahead, as a monotonic queue
+    std::array<float, ringSize> minimumValues {};
+    std::array<uint32_t, ringSize> minimumTimes {};
+    int minimumFront = 0;
+    int minimumCount = 0;
+    uint32_t sampleCounter = 0;
+    
+    float releasedGain = 1.0f;
+    std::array<float, ringSize> rampHistory {};
+    double rampSum = 0.0;
+    int rampIndex = 0;
+    
+    std::array<StereoFrame<double>, ringSize> delayLine {};
+    int delayIndex = 0;
+};
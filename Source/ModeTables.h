@@ -1,8 +1,9 @@
 #pragma once
 
-#include <vector>
+#include <array>
 #include <algorithm>
 #include <cmath>
+#include <utility>
 
 namespace CymaglyphModes {
 
@@ -18,7 +19,7 @@ struct CircularMode {
     int k;        // radial mode number  
     double alpha; // Bessel zero value
     
-    bool operator<(const CircularMode& other) const {
+    constexpr bool operator<(const CircularMode& other) const {
         return alpha < other.alpha;
     }
 };
@@ -28,54 +29,98 @@ struct SquareMode {
     int n;
     double lambda; // sqrt(m^2 + n^2)
     
-    bool operator<(const SquareMode& other) const {
+    constexpr bool operator<(const SquareMode& other) const {
         return lambda < other.lambda;
     }
 };
 
+constexpr int NUM_CIRCULAR_MODES = 25;
+constexpr int NUM_SQUARE_MODES = 64;
+
+// Compile-time helpers for the mode tables below
+constexpr double constexprSqrt(double x) {
+    if (x <= 0.0) return 0.0;
+    double guess = x > 1.0 ? x : 1.0;
+    for (int i = 0; i < 32; i++)
+        guess = 0.5 * (guess + x / guess);
+    return guess;
+}
+
+// Stable insertion sort; the tables are small and this keeps equal
+// eigenvalues in generation order
+template<typename ModeType, size_t Size>
+constexpr void sortModes(std::array<ModeType, Size>& modes) {
+    for (size_t i = 1; i < Size; i++) {
+        ModeType mode = modes[i];
+        size_t j = i;
+        for (; j > 0 && mode < modes[j - 1]; j--)
+            modes[j] = modes[j - 1];
+        modes[j] = mode;
+    }
+}
+
 // Build sorted mode lists
-inline std::vector<CircularMode> getCircularModes() {
-    std::vector<CircularMode> modes;
-    
-    // n=0 modes
-    for (int k = 0; k < 5; k++)
-        modes.push_back({0, k+1, J0_zeros[k]});
+constexpr std::array<CircularMode, NUM_CIRCULAR_MODES> makeCircularModes() {
+    const double* zeros[] = {J0_zeros, J1_zeros, J2_zeros, J3_zeros, J4_zeros};
+    std::array<CircularMode, NUM_CIRCULAR_MODES> modes {};
     
-    // n=1 modes
-    for (int k = 0; k < 5; k++)
-        modes.push_back({1, k+1, J1_zeros[k]});
-        
-    // n=2 modes
-    for (int k = 0; k < 5; k++)
-        modes.push_back({2, k+1, J2_zeros[k]});
-        
-    // n=3 modes
-    for (int k = 0; k < 5; k++)
-        modes.push_back({3, k+1, J3_zeros[k]});
+    // Angular orders n=0..4, five radial modes each
+    for (int n = 0; n < 5; n++)
+        for (int k = 0; k < 5; k++)
+            modes[n * 5 + k] = {n, k+1, zeros[n][k]};
     
-    // n=4 modes
-    for (int k = 0; k < 5; k++)
-        modes.push_back({4, k+1, J4_zeros[k]});
-    
-    std::sort(modes.begin(), modes.end());
+    sortModes(modes);
     return modes;
 }
 
-inline std::vector<SquareMode> getSquareModes() {
-    std::vector<SquareMode> modes;
+constexpr std::array<SquareMode, NUM_SQUARE_MODES> makeSquareModes() {
+    std::array<SquareMode, NUM_SQUARE_MODES> modes {};
     
     // Generate modes up to (8,8)
     for (int m = 1; m <= 8; m++) {
         for (int n = 1; n <= 8; n++) {
-            double lambda = std::sqrt(m*m + n*n);
-            modes.push_back({m, n, lambda});
+            double lambda = constexprSqrt(m*m + n*n);
+            modes[(m - 1) * 8 + (n - 1)] = {m, n, lambda};
         }
     }
     
-    std::sort(modes.begin(), modes.end());
+    sortModes(modes);
     return modes;
 }
 
+// Sorted at compile time; these live in read-only data
+inline constexpr auto circularModeTable = makeCircularModes();
+inline constexpr auto squareModeTable = makeSquareModes();
+
+// Eigenfrequencies relative to the lowest mode, for the synth's modal
+// resonators. A circular membrane's modes go as the Bessel zeros; a simply
+// supported square plate's go as m^2 + n^2, the square of lambda.
+constexpr std::array<float, NUM_CIRCULAR_MODES> makeMembraneRatios() {
+    std::array<float, NUM_CIRCULAR_MODES> ratios {};
+    for (int i = 0; i < NUM_CIRCULAR_MODES; i++)
+        ratios[i] = static_cast<float>(circularModeTable[i].alpha / circularModeTable[0].alpha);
+    return ratios;
+}
+
+constexpr std::array<float, NUM_SQUARE_MODES> makePlateRatios() {
+    const double fundamental = squareModeTable[0].lambda * squareModeTable[0].lambda;
+    std::array<float, NUM_SQUARE_MODES> ratios {};
+    for (int i = 0; i < NUM_SQUARE_MODES; i++)
+        ratios[i] = static_cast<float>(squareModeTable[i].lambda * squareModeTable[i].lambda / fundamental);
+    return ratios;
+}
+
+inline constexpr auto membraneRatios = makeMembraneRatios();
+inline constexpr auto plateRatios = makePlateRatios();
+
+inline const std::array<CircularMode, NUM_CIRCULAR_MODES>& getCircularModes() {
+    return circularModeTable;
+}
+
+inline const std::array<SquareMode, NUM_SQUARE_MODES>& getSquareModes() {
+    return squareModeTable;
+}
+
 // Map frequency to mode rank (0.0 to 1.0 normalized)
 inline float frequencyToModeRank(float freqHz, float minFreq = 27.5f, float maxFreq = 3520.0f) {
     float logFreq = std::log(freqHz);
@@ -85,15 +130,16 @@ inline float frequencyToModeRank(float freqHz, float minFreq = 27.5f, float maxF
 }
 
 // Get two modes to crossfade between based on rank
-template<typename ModeType>
-inline std::pair<ModeType, ModeType> getModePair(const std::vector<ModeType>& modes, float rank) {
-    if (modes.empty()) return {};
+template<typename ModeTable>
+inline auto getModePair(const ModeTable& modes, float rank) {
+    using ModeType = typename ModeTable::value_type;
+    if (modes.empty()) return std::pair<ModeType, ModeType>{};
     
     float modeIndex = rank * (modes.size() - 1);
     int lower = static_cast<int>(std::floor(modeIndex));
     int upper = std::min(lower + 1, static_cast<int>(modes.size() - 1));
     
-    return {modes[lower], modes[upper]};
+    return std::pair<ModeType, ModeType>{modes[lower], modes[upper]};
 }
 
 // Get crossfade fraction between modes
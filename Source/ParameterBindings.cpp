@@ -0,0 +1,59 @@
+#include "ParameterBindings.h"
+
+ParameterBindings::ParameterBindings(const PresetMorph& morph)
+{
+    oscDetune.bind(morph, "oscDetune");
+    oscPhase.bind(morph, "oscPhase");
+    unisonVoices.bind(morph, "unisonVoices");
+    unisonSpread.bind(morph, "unisonSpread");
+    fmAlgorithm.bind(morph, "fmAlgorithm");
+
+    filterType.bind(morph, "filterType");
+    filterDriveMode.bind(morph, "filterDriveMode");
+    filterCutoff.bind(morph, "filterCutoff");
+    filterResonance.bind(morph, "filterResonance");
+    filterDrive.bind(morph, "filterDrive");
+    filterEnvAmount.bind(morph, "filterEnvAmount");
+
+    ampAttack.bind(morph, "ampAttack");
+    ampDecay.bind(morph, "ampDecay");
+    ampSustain.bind(morph, "ampSustain");
+    ampRelease.bind(morph, "ampRelease");
+
+    lfo1Rate.bind(morph, "lfo1Rate");
+    lfo1Depth.bind(morph, "lfo1Depth");
+    lfo1Target.bind(morph, "lfo1Target");
+
+    reverbMix.bind(morph, "reverbMix");
+    reverbSize.bind(morph, "reverbSize");
+    chorusMix.bind(morph, "chorusMix");
+    chorusRate.bind(morph, "chorusRate");
+    chorusDepth.bind(morph, "chorusDepth");
+    delayMix.bind(morph, "delayMix");
+    delayTime.bind(morph, "delayTime");
+    delayFeedback.bind(morph, "delayFeedback");
+    solarFreeze.bind(morph, "solarFreeze");
+
+    masterVolume.bind(morph, "masterVolume");
+}
+
+void ParameterBindings::prepare(double sampleRate, int maxBlockSize)
+{
+    // 20ms is long enough to hide zipper noise on cutoff sweeps
+    filterCutoff.prepare(sampleRate, maxBlockSize, 0.02);
+    filterResonance.prepare(sampleRate, maxBlockSize, 0.02);
+    filterDrive.prepare(sampleRate, maxBlockSize, 0.02);
+    filterEnvAmount.prepare(sampleRate, maxBlockSize, 0.02);
+    lfo1Depth.prepare(sampleRate, maxBlockSize, 0.02);
+    masterVolume.prepare(sampleRate, maxBlockSize, 0.02);
+}
+
+void ParameterBindings::renderRamps(int numSamples)
+{
+    filterCutoff.render(numSamples);
+    filterResonance.render(numSamples);
+    filterDrive.render(numSamples);
+    filterEnvAmount.render(numSamples);
+    lfo1Depth.render(numSamples);
+    masterVolume.render(numSamples);
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "PresetMorph.h"
+#include <vector>
+
+// Typed handles onto the parameter values PresetMorph rebuilds each sub-block.
+// Every value is resolved once at construction, so the audio thread never
+// looks parameters up by name.
+class ParameterBindings
+{
+public:
+    // Block-rate parameter (times, choices, effect settings)
+    template <typename T>
+    class Value
+    {
+    public:
+        void bind(const PresetMorph& morph, const juce::String& parameterID)
+        {
+            source = morph.getValuePointer(parameterID);
+            jassert(source != nullptr);
+        }
+
+        T get() const { return static_cast<T>(*source); }
+
+    private:
+        const float* source = nullptr;
+    };
+
+    // Continuous parameter rendered once per block into a smoothed ramp.
+    // When the parameter is settled the ramp is flagged constant and the
+    // buffer is left untouched.
+    template <typename SmoothingType>
+    class Ramp
+    {
+    public:
+        void bind(const PresetMorph& morph, const juce::String& parameterID)
+        {
+            source = morph.getValuePointer(parameterID);
+            jassert(source != nullptr);
+            current = *source;
+            smoother.setCurrentAndTargetValue(current);
+        }
+
+        void prepare(double sampleRate, int maxBlockSize, double rampSeconds)
+        {
+            smoother.reset(sampleRate, rampSeconds);
+            current = *source;
+            smoother.setCurrentAndTargetValue(current);
+            buffer.assign(static_cast<size_t>(std::max(1, maxBlockSize)), current);
+            constant = true;
+        }
+
+        void render(int numSamples)
+        {
+            smoother.setTargetValue(*source);
+
+            if (!smoother.isSmoothing())
+            {
+                constant = true;
+                current = smoother.getTargetValue();
+                return;
+            }
+
+            // Hosts may exceed the prepared block size; grow rather than overrun
+            if (numSamples > static_cast<int>(buffer.size()))
+                buffer.resize(static_cast<size_t>(numSamples));
+
+            constant = false;
+            for (int i = 0; i < numSamples; ++i)
+            {
+                buffer[static_cast<size_t>(i)] = smoother.getNextValue();
+            }
+            current = smoother.getCurrentValue();
+        }
+
+        bool isConstant() const { return constant; }
+
+        // Value at the end of the block, or the settled value
+        float getValue() const { return current; }
+
+        float operator[](int sample) const
+        {
+            return constant ? current : buffer[static_cast<size_t>(sample)];
+        }
+
+        const float* getRamp() const { return constant ? nullptr : buffer.data(); }
+
+    private:
+        const float* source = nullptr;
+        juce::SmoothedValue<float, SmoothingType> smoother;
+        std::vector<float> buffer;
+        float current = 0.0f;
+        bool constant = true;
+    };
+
+    using LinearRamp = Ramp<juce::ValueSmoothingTypes::Linear>;
+    using FrequencyRamp = Ramp<juce::ValueSmoothingTypes::Multiplicative>;
+
+    explicit ParameterBindings(const PresetMorph& morph);
+
+    void prepare(double sampleRate, int maxBlockSize);
+    void renderRamps(int numSamples);
+
+    // Oscillator and unison
+    Value<float> oscDetune;
+    Value<float> oscPhase;
+    Value<int> unisonVoices;
+    Value<float> unisonSpread;
+    Value<int> fmAlgorithm;
+
+    // Filter
+    Value<int> filterType;
+    Value<int> filterDriveMode;
+    FrequencyRamp filterCutoff;
+    LinearRamp filterResonance;
+    LinearRamp filterDrive;
+    LinearRamp filterEnvAmount;
+
+    // Amp envelope
+    Value<float> ampAttack;
+    Value<float> ampDecay;
+    Value<float> ampSustain;
+    Value<float> ampRelease;
+
+    // LFO
+    Value<float> lfo1Rate;
+    LinearRamp lfo1Depth;
+    Value<int> lfo1Target;
+
+    // Effects
+    Value<float> reverbMix;
+    Value<float> reverbSize;
+    Value<float> chorusMix;
+    Value<float> chorusRate;
+    Value<float> chorusDepth;
+    Value<float> delayMix;
+    Value<float> delayTime;
+    Value<float> delayFeedback;
+    Value<bool> solarFreeze;
+
+    // Master
+    LinearRamp masterVolume;
+
+private:
+    JUCE_DECLARE_NON_COPYABLE(ParameterBindings)
+};
@@ -35,6 +35,25 @@ SandWizardAudioProcessorEditor::SandWizardAudioProcessorEditor(SandWizardAudioPr
         audioProcessor.setOctaveShift(octaveShift);
     };
     
+    settingsPanel->onMorphSlotClicked = [this](int slot) {
+        showMorphPresetMenu(slot);
+    };
+    
+    settingsPanel->onMorphSlotsCleared = [this]() {
+        audioProcessor.clearMorphPresets();
+        for (int slot = 0; slot < PresetMorph::numSlots; slot++)
+            settingsPanel->setMorphSlotName(slot, {});
+    };
+    
+    settingsPanel->setMemoryUsage(audioProcessor.getMemoryUsage());
+    
+    // Slots restored with the session have no preset name to show
+    for (int slot = 0; slot < PresetMorph::numSlots; slot++)
+    {
+        if (audioProcessor.isMorphSlotLoaded(slot))
+            settingsPanel->setMorphSlotName(slot, "SAVED");
+    }
+    
     // Set editor size
     setSize(900, 900);
     setResizable(true, true);
@@ -112,6 +131,13 @@ void SandWizardAudioProcessorEditor::timerCallback()
             settingsPanel->setVisible(false, false);
         }
     }
+    
+    // Refresh the memory readout about once a second
+    if (++memoryRefreshCounter >= 60)
+    {
+        memoryRefreshCounter = 0;
+        settingsPanel->setMemoryUsage(audioProcessor.getMemoryUsage());
+    }
 }
 
 // Legacy functions (kept for compatibility but not used)
@@ -246,4 +272,26 @@ void SandWizardAudioProcessorEditor::updatePresetList()
 
 void SandWizardAudioProcessorEditor::saveImage()
 {
+}
+
+void SandWizardAudioProcessorEditor::showMorphPresetMenu(int slot)
+{
+    const auto names = audioProcessor.getPresetNames();
+    
+    juce::PopupMenu menu;
+    for (int i = 0; i < names.size(); i++)
+        menu.addItem(i + 1, names[i]);
+    
+    if (names.isEmpty())
+        menu.addItem(1, "No presets saved", false);
+    
+    juce::Component::SafePointer<SandWizardAudioProcessorEditor> safeThis(this);
+    menu.showMenuAsync(juce::PopupMenu::Options().withTargetComponent(settingsPanel.get()),
+        [safeThis, slot, names](int result) {
+            if (safeThis == nullptr || result <= 0 || result > names.size())
+                return;
+            
+            if (safeThis->audioProcessor.loadMorphPreset(slot, names[result - 1]))
+                safeThis->settingsPanel->setMorphSlotName(slot, names[result - 1]);
+        });
 }
\ No newline at end of file
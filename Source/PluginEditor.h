@@ -38,6 +38,9 @@ private:
     void updatePresetList();
     void saveImage();
     
+    // Picks a preset for one of the A/B morph slots
+    void showMorphPresetMenu(int slot);
+    
     SandWizardAudioProcessor& audioProcessor;
     
     // Main components
@@ -48,6 +51,9 @@ private:
     // Silence detection
     float silenceTimer = 0.0f;
     
+    // Frames since the memory readout was last refreshed
+    int memoryRefreshCounter = 0;
+    
     // Keyboard tracking to prevent duplicate notes
     std::set<int> activeKeyNotes;
     
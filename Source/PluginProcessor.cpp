@@ -6,10 +6,25 @@
 SandWizardAudioProcessor::SandWizardAudioProcessor()
     : AudioProcessor(BusesProperties()
                     .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
-      apvts(*this, nullptr, "Parameters", createParameterLayout())
+      apvts(*this, nullptr, "Parameters", createParameterLayout()),
+      stateSerializer(*this),
+      restoredState(static_cast<size_t>(stateSerializer.getNumParameters())),
+      presetMorph(stateSerializer, apvts),
+      params(presetMorph)
 {
     // Initialize synthesis engine with advanced modes
     synthEngine = std::make_unique<SynthEngine>();
+    spareEngine = std::make_unique<SynthEngine>();
+    modeEngine = synthEngine.get();
+    fadeEngine = spareEngine.get();
+    
+    // Only the primary engine runs the master effects
+    synthEngine->prepareMasterEffects();
+    synthEngine->prepareMode(requestedSynthMode.load());
+    spareEngine->prepareMode(requestedSynthMode.load());
+    startTimer(250);
+    
+    presetLibrary = std::make_unique<PresetLibrary>(stateSerializer);
     
     // Initialize smoothed values
     smoothedFreq.setCurrentAndTargetValue(440.0f);
@@ -24,24 +39,37 @@ SandWizardAudioProcessor::SandWizardAudioProcessor()
 
 SandWizardAudioProcessor::~SandWizardAudioProcessor()
 {
+    stopTimer();
 }
 
 juce::AudioProcessorValueTreeState::ParameterLayout SandWizardAudioProcessor::createParameterLayout()
 {
     std::vector<std::unique_ptr<juce::RangedAudioParameter>> params;
     
-    // Oscillator Parameters
+    // Oscillator Parameters. Detune is the total unison spread in cents and
+    // phase how far unison phases are randomised at note-on.
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         "oscDetune", "Oscillator Detune", 
-        juce::NormalisableRange<float>(-50.0f, 50.0f, 0.1f), 0.0f));
+        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f), 7.0f));
     
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
-        "oscPhase", "Oscillator Phase", 0.0f, 1.0f, 0.0f));
+        "oscPhase", "Oscillator Phase", 0.0f, 1.0f, 1.0f));
+    
+    params.push_back(std::make_unique<juce::AudioParameterInt>(
+        "unisonVoices", "Unison Voices", 1, 16, 3));
+    
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        "unisonSpread", "Unison Spread", 0.0f, 1.0f, 0.5f));
+    
+    // Operator routing for Crystalline's FM tine, numbered as in the DX7 manuals
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        "fmAlgorithm", "FM Algorithm", 
+        juce::StringArray{"3 Stacks (5)", "Stack + Cascade (1)", "Cascade", "1 to 3 (22)", "Organ (32)"}, 0));
     
     // Filter Parameters
     params.push_back(std::make_unique<juce::AudioParameterChoice>(
         "filterType", "Filter Type", 
-        juce::StringArray{"Lowpass", "Highpass", "Bandpass", "Notch", "Off"}, 0));
+        juce::StringArray{"Lowpass", "Highpass", "Bandpass", "Notch", "Off", "Ladder"}, 0));
     
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         "filterCutoff", "Filter Cutoff", 
@@ -55,6 +83,10 @@ juce::AudioProcessorValueTreeState::ParameterLayout SandWizardAudioProcessor::cr
         "filterDrive", "Filter Drive", 
         juce::NormalisableRange<float>(0.0f, 2.0f, 0.01f), 0.0f));
     
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        "filterDriveMode", "Filter Drive Mode", 
+        juce::StringArray{"Tanh", "Asymmetric", "Hard Clip"}, 0));
+    
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         "filterEnvAmount", "Filter Env Amount", 
         juce::NormalisableRange<float>(-1.0f, 1.0f, 0.01f), 0.0f));
@@ -128,6 +160,10 @@ juce::AudioProcessorValueTreeState::ParameterLayout SandWizardAudioProcessor::cr
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         "delayFeedback", "Delay Feedback", 0.0f, 0.95f, 0.3f));
     
+    // Holds Solar Wind's diffusion network on its current spectrum
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        "solarFreeze", "Solar Freeze", false));
+    
     // Global Parameters
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         "masterVolume", "Master Volume", 
@@ -139,6 +175,9 @@ juce::AudioProcessorValueTreeState::ParameterLayout SandWizardAudioProcessor::cr
     params.push_back(std::make_unique<juce::AudioParameterInt>(
         "voiceCount", "Voice Count", 1, 16, 8));
     
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        "presetMorph", "Preset Morph", 0.0f, 1.0f, 0.0f));
+    
     // Keep visual parameters for backwards compatibility
     params.push_back(std::make_unique<juce::AudioParameterChoice>(
         "medium", "Medium", juce::StringArray{"Plate", "Membrane", "Water"}, 0));
@@ -191,11 +230,16 @@ std::vector<float> SandWizardAudioProcessor::getActiveFrequencies() const
 
 void SandWizardAudioProcessor::prepareToPlay(double sr, int samplesPerBlock)
 {
+    juce::ignoreUnused(samplesPerBlock); // Rendering always runs in fixed sub-blocks
     sampleRate = sr;
     
     // Configure smoothing with faster response for stability
     smoothedFreq.reset(sr, 0.005); // 5ms smoothing for quicker response
     smoothedGain.reset(sr, 0.005);
+    presetMorph.process();
+    params.prepare(sr, subBlockSize);
+    masterLimiter.prepare(sr);
+    setLatencySamples(masterLimiter.getLatencySamples());
     
     // Set initial values
     smoothedFreq.setCurrentAndTargetValue(440.0f);
@@ -204,7 +248,21 @@ void SandWizardAudioProcessor::prepareToPlay(double sr, int samplesPerBlock)
     // Reset synthesis engine for clean start
     if (synthEngine)
     {
+        synthEngine->setSampleRate(sr);
+        spareEngine->setSampleRate(sr);
         synthEngine->reset();
+        spareEngine->reset();
+    }
+    
+    // Any pending mode change applies immediately; there is nothing to fade from
+    activeSynthMode = requestedSynthMode.load(std::memory_order_acquire);
+    fadeLength = juce::jmax(1, static_cast<int>(sr * 0.005)); // 5ms equal-power crossfade
+    fadeSamplesRemaining = 0;
+    fadeEngineRetired = true; // reset() left both engines clean
+    if (synthEngine)
+    {
+        modeEngine->setRenderModes(1u << activeSynthMode);
+        fadeEngine->setRenderModes(0);
     }
     
     // Clear all voices
@@ -212,6 +270,7 @@ void SandWizardAudioProcessor::prepareToPlay(double sr, int samplesPerBlock)
     {
         voice.reset();
     }
+    monoVoice.reset();
     
     // Clear mono state
     currentMonoNote = -1;
@@ -236,127 +295,352 @@ bool SandWizardAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts
 
 void SandWizardAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
                                               juce::MidiBuffer& midiMessages)
+{
+    processBlockInternal(buffer, midiMessages);
+}
+
+void SandWizardAudioProcessor::processBlock(juce::AudioBuffer<double>& buffer,
+                                              juce::MidiBuffer& midiMessages)
+{
+    processBlockInternal(buffer, midiMessages);
+}
+
+template <typename SampleType>
+void SandWizardAudioProcessor::processBlockInternal(juce::AudioBuffer<SampleType>& buffer,
+                                                      juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
     
-    // Handle MIDI messages
-    for (const auto metadata : midiMessages)
-    {
-        const auto msg = metadata.getMessage();
-        handleMidiMessage(msg);
-    }
-    
     const int numChannels = buffer.getNumChannels();
     const int numSamples = buffer.getNumSamples();
-    const float phaseIncBase = static_cast<float>(1.0 / sampleRate);
     
     // Clear buffer first
     buffer.clear();
     
-    // Get effects parameters once
-    float reverbMix = *apvts.getRawParameterValue("reverbMix");
-    float reverbSize = *apvts.getRawParameterValue("reverbSize");
-    float chorusMix = *apvts.getRawParameterValue("chorusMix");
-    float chorusRate = *apvts.getRawParameterValue("chorusRate");
-    float chorusDepth = *apvts.getRawParameterValue("chorusDepth");
-    float delayMix = *apvts.getRawParameterValue("delayMix");
-    float delayTime = *apvts.getRawParameterValue("delayTime");
-    float delayFeedback = *apvts.getRawParameterValue("delayFeedback");
-    
-    // Get LFO parameters
-    lfo1.rate = *apvts.getRawParameterValue("lfo1Rate");
-    lfo1.depth = *apvts.getRawParameterValue("lfo1Depth");
-    int lfoTarget = static_cast<int>(*apvts.getRawParameterValue("lfo1Target"));
+    // Preset changes land whole, before any of this block is rendered
+    presetLibrary->applyPendingPreset();
+    
+    // Run the synth in fixed sub-blocks so per-sample cost does not depend
+    // on the host buffer size. MIDI is applied at sub-block boundaries.
+    auto midiIterator = midiMessages.cbegin();
+    
+    for (int offset = 0; offset < numSamples; offset += subBlockSize)
+    {
+        const int blockSamples = std::min(subBlockSize, numSamples - offset);
+        
+        for (; midiIterator != midiMessages.cend(); ++midiIterator)
+        {
+            const auto metadata = *midiIterator;
+            if (metadata.samplePosition >= offset + blockSamples)
+                break;
+            handleMidiMessage(metadata.getMessage());
+        }
+        
+        applyPendingModeChange();
+        processSubBlock<SampleType>(blockSamples);
+        
+        auto& rendered = getSubBlockBuffer<SampleType>();
+        masterLimiter.process(rendered.data(), blockSamples);
+        
+        // Deinterleave the rendered frames; a mono bus gets the mid
+        if (numChannels == 1)
+        {
+            auto* out = buffer.getWritePointer(0, offset);
+            for (int sample = 0; sample < blockSamples; ++sample)
+                out[sample] = rendered[sample].mid();
+        }
+        else if (numChannels > 1)
+        {
+            auto* left = buffer.getWritePointer(0, offset);
+            auto* right = buffer.getWritePointer(1, offset);
+            for (int sample = 0; sample < blockSamples; ++sample)
+            {
+                left[sample] = rendered[sample].left;
+                right[sample] = rendered[sample].right;
+            }
+        }
+    }
+}
+
+void SandWizardAudioProcessor::setSynthMode(int mode)
+{
+    if (!synthEngine || mode < 0 || mode >= SynthEngine::NumModes)
+        return;
+    
+    // Free what no longer plays, then make sure the new mode can render
+    // on whichever engine picks it up before posting the request
+    releaseIdleModes();
+    synthEngine->prepareMode(mode);
+    spareEngine->prepareMode(mode);
+    
+    requestedSynthMode.store(mode, std::memory_order_release);
+    modeRequestSerial.fetch_add(1, std::memory_order_release);
+}
+
+void SandWizardAudioProcessor::releaseIdleModes()
+{
+    // Until the audio thread has seen the latest request it could still
+    // switch to an older one, so nothing is safe to free
+    const uint32_t serial = modeRequestSerial.load(std::memory_order_acquire);
+    if (acknowledgedModeSerial.load(std::memory_order_acquire) != serial)
+        return;
+    
+    // After the acknowledgement this set can only shrink
+    const uint32_t inUse = renderingModeMask.load(std::memory_order_acquire)
+                         | (1u << requestedSynthMode.load(std::memory_order_acquire));
+    
+    for (int mode = 0; mode < SynthEngine::NumModes; ++mode)
+    {
+        if ((inUse & (1u << mode)) == 0)
+        {
+            synthEngine->releaseMode(mode);
+            spareEngine->releaseMode(mode);
+        }
+    }
+}
+
+size_t SandWizardAudioProcessor::getMemoryUsage() const
+{
+    size_t bytes = sizeof(*this);
+    if (synthEngine)
+        bytes += synthEngine->getMemoryUsage() + spareEngine->getMemoryUsage();
+    return bytes;
+}
+
+void SandWizardAudioProcessor::applyPendingModeChange()
+{
+    // Serial first: the mode read below is then at least as new as it
+    const uint32_t serial = modeRequestSerial.load(std::memory_order_acquire);
+    const int requested = requestedSynthMode.load(std::memory_order_acquire);
+    
+    // Once the outgoing mode has faded out its engine sits idle; its state is
+    // retired then, and cleared a buffer per sub-block until the next switch
+    if (fadeSamplesRemaining == 0 && !fadeEngineRetired)
+    {
+        fadeEngine->retireModeState();
+        fadeEngine->setRenderModes(0);
+        fadeEngineRetired = true;
+    }
+    
+    // A change arriving mid-fade waits for the fade to finish
+    if (requested != activeSynthMode && fadeSamplesRemaining == 0)
+        switchSynthMode(requested);
+    
+    if (fadeSamplesRemaining == 0)
+        fadeEngine->scrubModeState();
+    
+    // Publish the modes this thread may still render, then acknowledge
+    uint32_t mask = 1u << activeSynthMode;
+    if (fadeSamplesRemaining > 0)
+        mask |= 1u << fadeSynthMode;
+    renderingModeMask.store(mask, std::memory_order_release);
+    acknowledgedModeSerial.store(serial, std::memory_order_release);
+}
+
+void SandWizardAudioProcessor::switchSynthMode(int requested)
+{
+    // The outgoing mode keeps rendering on its engine while it fades out
+    std::swap(modeEngine, fadeEngine);
+    fadeSynthMode = activeSynthMode;
+    activeSynthMode = requested;
+    fadeSamplesRemaining = fadeLength;
+    fadeEngineRetired = false;
+    
+    // The incoming mode starts from clean state with the held notes
+    // retriggered. The outgoing engine keeps its mode until the fade ends.
+    modeEngine->setRenderModes(1u << requested);
+    modeEngine->resetModeState();
+    if (isMonophonic.load())
+    {
+        if (currentMonoNote >= 0)
+            modeEngine->noteOn(0, monoVelocity);
+    }
+    else
+    {
+        for (int voiceIndex = 0; voiceIndex < MAX_VOICES; ++voiceIndex)
+        {
+            const auto& voice = voices[voiceIndex];
+            if (voice.active && voice.ampEnvStage != Voice::Release)
+                modeEngine->noteOn(voiceIndex, voice.targetAmplitude);
+        }
+    }
+}
+
+SandWizardAudioProcessor::ModeFade SandWizardAudioProcessor::nextModeFade()
+{
+    if (fadeSamplesRemaining <= 0)
+        return {};
+    
+    const float position = 1.0f - static_cast<float>(fadeSamplesRemaining) / static_cast<float>(fadeLength);
+    const float angle = position * juce::MathConstants<float>::halfPi;
+    --fadeSamplesRemaining;
+    return { std::sin(angle), std::cos(angle) };
+}
+
+StereoFrame<float> SandWizardAudioProcessor::generateModeSample(const ModeFade& fade, float phase,
+                                                                float frequency, int voiceIndex)
+{
+    auto output = modeEngine->generateSample(phase, frequency, activeSynthMode, voiceIndex);
+    if (fade.outgoing > 0.0f)
+    {
+        const auto outgoing = fadeEngine->generateSample(phase, frequency, fadeSynthMode, voiceIndex);
+        output = output * StereoFrame<float>(fade.incoming) + outgoing * StereoFrame<float>(fade.outgoing);
+    }
+    return output;
+}
+
+// Both engines follow the notes so the outgoing mode releases normally mid-fade
+void SandWizardAudioProcessor::engineNoteOn(int voiceIndex, float velocity)
+{
+    if (synthEngine)
+    {
+        synthEngine->noteOn(voiceIndex, velocity);
+        spareEngine->noteOn(voiceIndex, velocity);
+    }
+}
+
+void SandWizardAudioProcessor::engineNoteOff(int voiceIndex)
+{
+    if (synthEngine)
+    {
+        synthEngine->noteOff(voiceIndex);
+        spareEngine->noteOff(voiceIndex);
+    }
+}
+
+template <typename SampleType>
+void SandWizardAudioProcessor::processSubBlock(int numSamples)
+{
+    const float phaseIncBase = static_cast<float>(1.0 / sampleRate);
+    
+    auto& subBlock = getSubBlockBuffer<SampleType>();
+    subBlock.fill(StereoFrame<SampleType>());
+    
+    // Control-rate work happens once per sub-block
+    presetMorph.process();
+    params.renderRamps(numSamples);
+    
+    // LFO is evaluated at both sub-block edges and interpolated in between
+    lfo1.rate = params.lfo1Rate.get();
+    lfo1.depth = params.lfo1Depth.getValue();
+    const int lfoTarget = params.lfo1Target.get();
+    const float lfoStart = lfo1.getValue();
+    const float lfoEnd = lfo1.advance(numSamples, static_cast<float>(sampleRate));
+    const float lfoStep = (lfoEnd - lfoStart) / static_cast<float>(numSamples);
     
     // Update effect parameters for synthesis engine
     if (synthEngine)
     {
-        synthEngine->setReverbParameters(reverbSize, reverbMix);
-        synthEngine->setChorusParameters(chorusRate, chorusDepth, chorusMix);
-        synthEngine->setDelayParameters(delayTime, delayFeedback, delayMix);
+        synthEngine->setReverbParameters(params.reverbSize.get(), params.reverbMix.get());
+        synthEngine->setChorusParameters(params.chorusRate.get(), params.chorusDepth.get(), params.chorusMix.get());
+        synthEngine->setDelayParameters(params.delayTime.get(), params.delayFeedback.get(), params.delayMix.get());
+        synthEngine->setFilterDriveMode(params.filterDriveMode.get());
+        
+        // Both engines render modes, so both carry the mode settings
+        for (auto* engine : { synthEngine.get(), spareEngine.get() })
+        {
+            engine->setUnisonParameters(params.unisonVoices.get(), params.oscDetune.get(),
+                                        params.unisonSpread.get(), params.oscPhase.get());
+            engine->setFMAlgorithm(params.fmAlgorithm.get());
+            engine->setSolarFreeze(params.solarFreeze.get());
+        }
     }
     
+    const int filterType = params.filterType.get();
+    const float filterCutoff = params.filterCutoff[0];
+    const float filterResonance = params.filterResonance[0];
+    const float filterDrive = params.filterDrive[0];
+    const auto& masterVolume = params.masterVolume;
+    
     bool mono = isMonophonic.load();
-    int synthMode = currentSynthMode.load();
     
     if (mono)
     {
         // Monophonic mode - single note at a time
         if (currentMonoNote < 0)
         {
-            return; // No note playing
+            // No note playing; a mode fade still runs out on schedule
+            fadeSamplesRemaining = std::max(0, fadeSamplesRemaining - numSamples);
+            return;
         }
         
         float targetFreq = noteToFrequency(currentMonoNote);
         smoothedFreq.setTargetValue(targetFreq);
         
-        // Get filter and effects parameters
-        float filterCutoff = *apvts.getRawParameterValue("filterCutoff");
-        float filterResonance = *apvts.getRawParameterValue("filterResonance");
-        int filterType = static_cast<int>(*apvts.getRawParameterValue("filterType"));
-        float masterVolume = *apvts.getRawParameterValue("masterVolume");
+        // Filter coefficients for this sub-block
+        float modulatedCutoff = filterCutoff;
+        if (lfoTarget == 2) // Filter target
+        {
+            modulatedCutoff *= (1.0f + lfoStart);
+        }
+        modulatedCutoff = std::clamp(modulatedCutoff, 20.0f, 20000.0f);
         
-        // Create a mono voice for filtering
-        static Voice monoVoice;
+        if (filterType < 4) // 0-3 are filter types, 4 is "Off"
+        {
+            monoVoice.filter.setCoefficients(modulatedCutoff, filterResonance, static_cast<float>(sampleRate));
+        }
+        else if (filterType == 5) // Ladder
+        {
+            synthEngine->setVoiceFilter(0, modulatedCutoff, filterResonance, filterDrive);
+        }
+        
+        // Pan gains at both sub-block edges, interpolated like the LFO; the
+        // mono voice sits at centre
+        float panStart = monoVoice.pan;
+        float panEnd = monoVoice.pan;
+        if (lfoTarget == 4) // Pan target
+        {
+            panStart += lfoStart;
+            panEnd += lfoEnd;
+        }
+        const StereoFrame<float> panGainStart = panGains(panStart);
+        const StereoFrame<float> panGainStep = (panGains(panEnd) - panGainStart)
+                                             * StereoFrame<float>(1.0f / static_cast<float>(numSamples));
         
         for (int sample = 0; sample < numSamples; ++sample)
         {
-            const float gain = smoothedGain.getNextValue();
+            // Same headroom as the poly mix, so switching modes keeps the level
+            const float gain = smoothedGain.getNextValue() * outputHeadroom;
             const float freq = smoothedFreq.getNextValue(); // Smooth frequency changes
-            
-            // Calculate LFO once per sample
-            float lfoValue = lfo1.process(sampleRate);
+            const float lfoValue = lfoStart + lfoStep * static_cast<float>(sample);
+            const ModeFade fade = nextModeFade();
+            const StereoFrame<float> panGain = panGainStart + panGainStep * StereoFrame<float>(static_cast<float>(sample));
             
             // Apply LFO modulation based on target
             float modulatedFreq = freq;
-            float modulatedCutoff = filterCutoff;
             float amplitudeModulation = 1.0f;
             
             if (lfoTarget == 1) // Pitch target
             {
                 modulatedFreq *= (1.0f + lfoValue * 0.1f);
             }
-            else if (lfoTarget == 2) // Filter target
-            {
-                modulatedCutoff *= (1.0f + lfoValue);
-            }
             else if (lfoTarget == 3) // Amplitude target
             {
                 amplitudeModulation = (1.0f + lfoValue * 0.5f);
             }
             
-            modulatedCutoff = std::clamp(modulatedCutoff, 20.0f, 20000.0f);
-            
             // Generate waveform using synthesis engine
-            float output = synthEngine->generateSample(monoPhase, modulatedFreq, synthMode) * gain * amplitudeModulation;
+            StereoFrame<float> voiceOut = generateModeSample(fade, monoPhase, modulatedFreq, 0)
+                                        * StereoFrame<float>(gain * amplitudeModulation) * panGain;
             
             // Apply filter if enabled
             if (filterType < 4) // 0-3 are filter types, 4 is "Off"
             {
-                output = monoVoice.filter.process(output, modulatedCutoff, filterResonance, sampleRate, filterType);
+                voiceOut = monoVoice.filter.process(voiceOut, filterType);
             }
-            
-            // Apply effects through synthesis engine
-            if (synthEngine)
+            else if (filterType == 5) // Ladder
             {
-                output = synthEngine->processEffects(output);
+                voiceOut = synthEngine->processVoiceFilter(0, voiceOut);
             }
             
+            // Effects and output stage run at the host's precision
+            auto output = synthEngine->processEffects(StereoFrame<SampleType>(voiceOut));
+            
             // Apply DC blocker (high-pass filter at ~20Hz)
-            const float dcBlockerCutoff = 0.995f;
-            float dcBlockerOutput = output - dcBlockerX1 + dcBlockerCutoff * dcBlockerY1;
-            dcBlockerX1 = output;
-            dcBlockerY1 = dcBlockerOutput;
-            output = dcBlockerOutput;
+            output = applyDCBlocker(output);
             
             // Apply master volume
-            output *= masterVolume;
-            
-            // Write to all channels
-            for (int channel = 0; channel < numChannels; ++channel)
-            {
-                buffer.getWritePointer(channel)[sample] = output;
-            }
+            subBlock[sample] = output * StereoFrame<SampleType>(static_cast<SampleType>(masterVolume[sample]));
             
             // Update phase
             const float phaseInc = modulatedFreq * phaseIncBase;
@@ -369,54 +653,85 @@ void SandWizardAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     }
     else // Polyphonic
     {
-        // Get envelope parameters
-        float ampAttack = *apvts.getRawParameterValue("ampAttack");
-        float ampDecay = *apvts.getRawParameterValue("ampDecay");
-        float ampSustain = *apvts.getRawParameterValue("ampSustain");
-        float ampRelease = *apvts.getRawParameterValue("ampRelease");
+        // Envelope rates for this sub-block
+        const auto envelopeRates = makeEnvelopeRates(params.ampAttack.get(), params.ampDecay.get(),
+                                                     params.ampSustain.get(), params.ampRelease.get());
         
-        float filterCutoff = *apvts.getRawParameterValue("filterCutoff");
-        float filterResonance = *apvts.getRawParameterValue("filterResonance");
-        int filterType = static_cast<int>(*apvts.getRawParameterValue("filterType"));
-        float filterEnvAmount = *apvts.getRawParameterValue("filterEnvAmount");
+        const float filterEnvAmount = params.filterEnvAmount[0];
+        const bool ladder = (filterType == 5);
+        
+        // Per-voice filter coefficients for this sub-block
+        for (int voiceIndex = 0; voiceIndex < MAX_VOICES; ++voiceIndex)
+        {
+            auto& voice = voices[voiceIndex];
+            if (!voice.active)
+                continue;
+            
+            // Calculate filter cutoff with envelope and LFO modulation
+            float envModulatedCutoff = filterCutoff;
+            if (filterEnvAmount != 0.0f)
+            {
+                // Filter envelope processing
+                envModulatedCutoff = filterCutoff * (1.0f + filterEnvAmount * voice.filterEnvLevel);
+            }
+            
+            // Apply LFO modulation based on target
+            if (lfoTarget == 2) // Filter target
+            {
+                envModulatedCutoff *= (1.0f + lfoStart);
+            }
+            
+            envModulatedCutoff = std::clamp(envModulatedCutoff, 20.0f, 20000.0f);
+            
+            if (ladder)
+            {
+                synthEngine->setVoiceFilter(voiceIndex, envModulatedCutoff, filterResonance, filterDrive);
+            }
+            else if (filterType < 4)
+            {
+                voice.filter.setCoefficients(envModulatedCutoff, filterResonance, static_cast<float>(sampleRate));
+            }
+            
+            // Pan gains at both sub-block edges, interpolated like the LFO
+            float panStart = voice.pan;
+            float panEnd = voice.pan;
+            if (lfoTarget == 4) // Pan target
+            {
+                panStart += lfoStart;
+                panEnd += lfoEnd;
+            }
+            voicePanGains[voiceIndex] = panGains(panStart);
+            voicePanSteps[voiceIndex] = (panGains(panEnd) - voicePanGains[voiceIndex])
+                                      * StereoFrame<float>(1.0f / static_cast<float>(numSamples));
+        }
+        
+        // Ladder voices are gathered per sample and filtered in one pass
+        alignas(32) std::array<StereoFrame<float>, SynthEngine::MAX_VOICES> ladderInputs {};
+        std::array<StereoFrame<float>, SynthEngine::MAX_VOICES> ladderGains {};
         
         // Polyphonic mode - multiple voices
         for (int sample = 0; sample < numSamples; ++sample)
         {
-            float output = 0.0f;
-            int activeVoices = 0;
+            StereoFrame<float> mix;
+            const float lfoValue = lfoStart + lfoStep * static_cast<float>(sample);
+            const ModeFade fade = nextModeFade();
             
-            // Calculate LFO once per sample (not per voice!)
-            float lfoValue = lfo1.process(sampleRate);
+            if (ladder)
+            {
+                ladderInputs.fill(StereoFrame<float>());
+                ladderGains.fill(StereoFrame<float>());
+            }
             
-            for (auto& voice : voices)
+            for (int voiceIndex = 0; voiceIndex < MAX_VOICES; ++voiceIndex)
             {
+                auto& voice = voices[voiceIndex];
                 if (voice.active)
                 {
-                    activeVoices++;
-                    
                     // Process amplitude envelope
-                    processEnvelope(voice, ampAttack, ampDecay, ampSustain, ampRelease);
+                    processEnvelope(voice, envelopeRates);
                     
                     if (voice.ampEnvLevel > 0.001f)
                     {
-                        
-                        // Calculate filter cutoff with envelope and LFO modulation
-                        float envModulatedCutoff = filterCutoff;
-                        if (filterEnvAmount != 0.0f)
-                        {
-                            // Filter envelope processing
-                            envModulatedCutoff = filterCutoff * (1.0f + filterEnvAmount * voice.filterEnvLevel);
-                        }
-                        
-                        // Apply LFO modulation based on target
-                        if (lfoTarget == 2) // Filter target
-                        {
-                            envModulatedCutoff *= (1.0f + lfoValue);
-                        }
-                        
-                        envModulatedCutoff = std::clamp(envModulatedCutoff, 20.0f, 20000.0f);
-                        
                         // Apply pitch modulation if LFO targets pitch
                         float modulatedFreq = voice.frequency;
                         if (lfoTarget == 1) // Pitch target
@@ -425,25 +740,35 @@ void SandWizardAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
                         }
                         
                         // Generate waveform using synthesis engine
-                        float voiceOut = synthEngine->generateSample(voice.phase, modulatedFreq, synthMode);
-                        
-                        // Apply filter if enabled
-                        if (filterType < 4) // 0-3 are filter types, 4 is "Off"
-                        {
-                            // Process the filter and get the filtered output
-                            voiceOut = voice.filter.process(voiceOut, envModulatedCutoff, filterResonance, sampleRate, filterType);
-                        }
+                        StereoFrame<float> voiceOut = generateModeSample(fade, voice.phase, modulatedFreq, voiceIndex);
                         
                         // Apply amplitude envelope and velocity
-                        voiceOut *= voice.ampEnvLevel * voice.targetAmplitude;
+                        float voiceGain = voice.ampEnvLevel * voice.targetAmplitude;
                         
                         // Apply amplitude modulation if LFO targets amplitude
                         if (lfoTarget == 3) // Amplitude target
                         {
-                            voiceOut *= (1.0f + lfoValue * 0.5f);
+                            voiceGain *= (1.0f + lfoValue * 0.5f);
                         }
                         
-                        output += voiceOut;
+                        const StereoFrame<float> panGain = voicePanGains[voiceIndex]
+                                                         + voicePanSteps[voiceIndex] * StereoFrame<float>(static_cast<float>(sample));
+                        
+                        // Apply filter if enabled
+                        if (ladder)
+                        {
+                            ladderInputs[voiceIndex] = voiceOut;
+                            ladderGains[voiceIndex] = StereoFrame<float>(voiceGain) * panGain;
+                        }
+                        else
+                        {
+                            if (filterType < 4) // 0-3 are filter types, 4 is "Off"
+                            {
+                                voiceOut = voice.filter.process(voiceOut, filterType);
+                            }
+                            
+                            mix += voiceOut * StereoFrame<float>(voiceGain) * panGain;
+                        }
                         
                         // Update phase
                         const float phaseInc = voice.frequency * phaseIncBase;
@@ -457,34 +782,26 @@ void SandWizardAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
                 }
             }
             
-            // Scale output by number of voices to prevent clipping
-            if (activeVoices > 0)
+            if (ladder)
             {
-                output *= smoothedGain.getNextValue() / std::sqrt(static_cast<float>(activeVoices));
+                synthEngine->processVoiceFilters(ladderInputs.data());
+                for (int voiceIndex = 0; voiceIndex < MAX_VOICES; ++voiceIndex)
+                {
+                    mix += ladderInputs[voiceIndex] * ladderGains[voiceIndex];
+                }
             }
             
-            // Apply effects through synthesis engine
-            if (synthEngine)
-            {
-                output = synthEngine->processEffects(output);
-            }
+            // Constant headroom, so the level does not jump as voices start and stop
+            mix *= StereoFrame<float>(smoothedGain.getNextValue() * outputHeadroom);
+            
+            // Effects and output stage run at the host's precision
+            auto output = synthEngine->processEffects(StereoFrame<SampleType>(mix));
             
             // Apply DC blocker
-            const float dcBlockerCutoff = 0.995f;
-            float dcBlockerOutput = output - dcBlockerX1 + dcBlockerCutoff * dcBlockerY1;
-            dcBlockerX1 = output;
-            dcBlockerY1 = dcBlockerOutput;
-            output = dcBlockerOutput;
+            output = applyDCBlocker(output);
             
             // Apply master volume
-            float masterVolume = *apvts.getRawParameterValue("masterVolume");
-            output *= masterVolume;
-            
-            // Write to all channels
-            for (int channel = 0; channel < numChannels; ++channel)
-            {
-                buffer.getWritePointer(channel)[sample] = output;
-            }
+            subBlock[sample] = output * StereoFrame<SampleType>(static_cast<SampleType>(masterVolume[sample]));
         }
         
         // Update current frequency to average of playing notes for visualization
@@ -503,8 +820,6 @@ void SandWizardAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
             currentFrequency.store(avgFreq / count);
         }
     }
-    
-    // Note: Effects processing has been moved into the main synthesis loop above
 }
 
 
@@ -538,6 +853,9 @@ void SandWizardAudioProcessor::handleMidiMessage(const juce::MidiMessage& messag
             float freq = noteToFrequency(currentMonoNote);
             currentFrequency.store(freq);
             smoothedFreq.setTargetValue(freq);
+            
+            monoVelocity = message.getFloatVelocity();
+            engineNoteOn(0, monoVelocity);
         }
         else if (message.isNoteOff())
         {
@@ -564,6 +882,8 @@ void SandWizardAudioProcessor::handleMidiMessage(const juce::MidiMessage& messag
                 {
                     // No more notes held
                     currentMonoNote = -1;
+                    
+                    engineNoteOff(0);
                 }
             }
         }
@@ -572,6 +892,8 @@ void SandWizardAudioProcessor::handleMidiMessage(const juce::MidiMessage& messag
             // Clear all held notes
             heldMonoNotes.clear();
             currentMonoNote = -1;
+            
+            engineNoteOff(0);
         }
     }
     else // Polyphonic
@@ -588,6 +910,7 @@ void SandWizardAudioProcessor::handleMidiMessage(const juce::MidiMessage& messag
                 // Retrigger existing voice
                 existingVoice->targetAmplitude = velocity;
                 existingVoice->amplitude = existingVoice->amplitude * 0.5f; // Soft retrigger
+                engineNoteOn(static_cast<int>(existingVoice - voices.data()), velocity);
                 return;
             }
             
@@ -619,30 +942,36 @@ void SandWizardAudioProcessor::handleMidiMessage(const juce::MidiMessage& messag
             voice->noteNumber = noteNumber;
             voice->frequency = noteToFrequency(noteNumber);
             voice->phase = 0.0f;
+            voice->pan = std::clamp((noteNumber - 60) / 48.0f, -0.5f, 0.5f); // Key-tracked spread
             voice->targetAmplitude = velocity;
             voice->amplitude = 0.0f; // Start from 0 for smooth attack
             voice->startNote(); // Start envelopes
+            
+            engineNoteOn(static_cast<int>(voice - voices.data()), velocity);
         }
         else if (message.isNoteOff())
         {
             int noteNumber = message.getNoteNumber();
             
             // Release all voices playing this note
-            for (auto& voice : voices)
+            for (int voiceIndex = 0; voiceIndex < MAX_VOICES; ++voiceIndex)
             {
+                auto& voice = voices[voiceIndex];
                 if (voice.active && voice.noteNumber == noteNumber)
                 {
                     voice.stopNote(); // Trigger release stage
                     // Don't immediately deactivate, let envelope fade out
+                    engineNoteOff(voiceIndex);
                 }
             }
         }
         else if (message.isAllNotesOff() || message.isAllSoundOff())
         {
             // Stop all voices immediately
-            for (auto& voice : voices)
+            for (int voiceIndex = 0; voiceIndex < MAX_VOICES; ++voiceIndex)
             {
-                voice.reset();
+                voices[voiceIndex].reset();
+                engineNoteOff(voiceIndex);
             }
         }
     }
@@ -681,66 +1010,60 @@ float SandWizardAudioProcessor::noteToFrequency(int noteNumber)
 
 void SandWizardAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    auto state = apvts.copyState();
-    std::unique_ptr<juce::XmlElement> xml(state.createXml());
-    copyXmlToBinary(*xml, destData);
+    PresetMorph::Slots morphSlots;
+    presetMorph.getSlots(morphSlots);
+    stateSerializer.write(destData, morphSlots);
 }
 
 void SandWizardAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
-    std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
+    PresetMorph::Slots morphSlots;
+    for (auto& slot : morphSlots)
+    {
+        slot.values.resize(static_cast<size_t>(stateSerializer.getNumParameters()));
+    }
     
-    if (xmlState.get() != nullptr)
+    if (sizeInBytes <= 0 || ! stateSerializer.read(data, static_cast<size_t>(sizeInBytes), restoredState, morphSlots))
+        return;
+    
+    // Like replaceState, parameters missing from the state return to default
+    for (int i = 0; i < stateSerializer.getNumParameters(); i++)
     {
-        if (xmlState->hasTagName(apvts.state.getType()))
-        {
-            apvts.replaceState(juce::ValueTree::fromXml(*xmlState));
-        }
+        auto& parameter = stateSerializer.getParameter(i);
+        const float value = restoredState[static_cast<size_t>(i)];
+        parameter.setValueNotifyingHost(std::isnan(value) ? parameter.getDefaultValue() : value);
     }
+    
+    // Older states carry no slots, so they come back empty
+    presetMorph.setSlots(morphSlots);
 }
 
 void SandWizardAudioProcessor::loadPreset(const juce::String& presetName)
 {
-    auto presetsDir = juce::File::getSpecialLocation(juce::File::currentApplicationFile)
-                        .getChildFile("Presets");
-    auto presetFile = presetsDir.getChildFile(presetName + ".xml");
-    
-    if (presetFile.existsAsFile())
-    {
-        juce::MemoryBlock data;
-        presetFile.loadFileAsData(data);
-        setStateInformation(data.getData(), static_cast<int>(data.getSize()));
-    }
+    presetLibrary->applyPreset(presetName);
 }
 
 void SandWizardAudioProcessor::savePreset(const juce::String& presetName)
 {
-    auto presetsDir = juce::File::getSpecialLocation(juce::File::currentApplicationFile)
-                        .getChildFile("Presets");
-    presetsDir.createDirectory();
-    
-    auto presetFile = presetsDir.getChildFile(presetName + ".xml");
-    
+    // Presets hold parameters only; the morph slots stay with the session
     juce::MemoryBlock data;
-    getStateInformation(data);
-    presetFile.replaceWithData(data.getData(), data.getSize());
+    stateSerializer.write(data);
+    presetLibrary->savePreset(presetName, data);
 }
 
 juce::StringArray SandWizardAudioProcessor::getPresetNames()
 {
-    juce::StringArray presets;
-    auto presetsDir = juce::File::getSpecialLocation(juce::File::currentApplicationFile)
-                        .getChildFile("Presets");
-    
-    if (presetsDir.exists())
-    {
-        for (auto& file : presetsDir.findChildFiles(juce::File::findFiles, false, "*.xml"))
-        {
-            presets.add(file.getFileNameWithoutExtension());
-        }
-    }
+    return presetLibrary->getPresetNames();
+}
+
+bool SandWizardAudioProcessor::loadMorphPreset(int slot, const juce::String& presetName)
+{
+    std::vector<float> values;
+    if (! presetLibrary->getPresetValues(presetName, values))
+        return false;
     
-    return presets;
+    presetMorph.setSlot(slot, values);
+    return true;
 }
 
 juce::AudioProcessorEditor* SandWizardAudioProcessor::createEditor()
@@ -748,12 +1071,18 @@ juce::AudioProcessorEditor* SandWizardAudioProcessor::createEditor()
     return new SandWizardAudioProcessorEditor(*this);
 }
 
-void SandWizardAudioProcessor::processEnvelope(Voice& voice, float attack, float decay, float sustain, float release)
+SandWizardAudioProcessor::EnvelopeRates SandWizardAudioProcessor::makeEnvelopeRates(float attack, float decay, float sustain, float release) const
+{
+    const float sr = static_cast<float>(sampleRate);
+    return { 1.0f / (attack * sr), 1.0f / (decay * sr), sustain, 1.0f / (release * sr) };
+}
+
+void SandWizardAudioProcessor::processEnvelope(Voice& voice, const EnvelopeRates& rates)
 {
-    const float sampleRate = getSampleRate();
-    const float attackRate = 1.0f / (attack * sampleRate);
-    const float decayRate = 1.0f / (decay * sampleRate);
-    const float releaseRate = 1.0f / (release * sampleRate);
+    const float attackRate = rates.attack;
+    const float decayRate = rates.decay;
+    const float sustain = rates.sustain;
+    const float releaseRate = rates.release;
     
     // Process amplitude envelope
     switch (voice.ampEnvStage)
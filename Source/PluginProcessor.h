@@ -3,12 +3,17 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 #include "SynthEngine.h"
+#include "MasterLimiter.h"
+#include "ParameterBindings.h"
+#include "StateSerializer.h"
+#include "PresetLibrary.h"
 #include <atomic>
 #include <vector>
 #include <array>
 
 class SandWizardAudioProcessor : public juce::AudioProcessor,
-                                public juce::AudioProcessorValueTreeState::Listener
+                                public juce::AudioProcessorValueTreeState::Listener,
+                                private juce::Timer
 {
 public:    
     SandWizardAudioProcessor();
@@ -22,6 +27,8 @@ public:
     #endif
 
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock(juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override { return true; }
 
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override { return true; }
@@ -48,12 +55,14 @@ public:
     // APVTS getter
     juce::AudioProcessorValueTreeState& getAPVTS() { return apvts; }
     
-    // Synthesis control
-    void setSynthMode(int mode) { 
-        currentSynthMode = mode; 
-        if (synthEngine) synthEngine->reset(); // Reset to prevent audio issues
-    }
-    int getSynthMode() const { return currentSynthMode.load(); }
+    // Synthesis control. Mode changes are only posted here; the audio thread
+    // picks them up at the next sub-block and crossfades into the new mode.
+    // Call from the message thread: per-mode state is allocated here.
+    void setSynthMode(int mode);
+    int getSynthMode() const { return requestedSynthMode.load(std::memory_order_acquire); }
+    
+    // Bytes held by the synthesis engines and the processor itself
+    size_t getMemoryUsage() const;
     void setMonophonic(bool mono) { 
         isMonophonic = mono; 
         // Clear all notes when switching modes
@@ -76,10 +85,18 @@ public:
     // MIDI handling (public for keyboard input)
     void handleMidiMessage(const juce::MidiMessage& message);
     
-    // Preset management (keeping for potential future use)
+    // Preset management. Presets are indexed in the background and applied
+    // by the audio thread at the next block boundary.
     void loadPreset(const juce::String& presetName);
     void savePreset(const juce::String& presetName);
     juce::StringArray getPresetNames();
+    
+    // A/B morph. Once both slots hold a preset, the Preset Morph parameter
+    // sweeps every parameter they share from A to B. The slots are saved
+    // with the plugin state.
+    bool loadMorphPreset(int slot, const juce::String& presetName);
+    void clearMorphPresets() { presetMorph.clearSlots(); }
+    bool isMorphSlotLoaded(int slot) const { return presetMorph.isSlotLoaded(slot); }
 
 private:
     // Voice structure for polyphonic synthesis
@@ -102,25 +119,34 @@ private:
         // Voice-specific filter state
         float filterCutoff = 1000.0f;
         
-        // State variable filter for per-voice filtering
+        // Stereo position, -1 (left) to 1 (right)
+        float pan = 0.0f;
+        
+        // State variable filter for per-voice filtering, both channels in one pass
         struct SVFilter {
-            float low = 0.0f;
-            float band = 0.0f;
-            float high = 0.0f;
-            float notch = 0.0f;
-            float peak = 0.0f;
+            StereoFrame<float> low;
+            StereoFrame<float> band;
+            StereoFrame<float> high;
+            StereoFrame<float> notch;
+            StereoFrame<float> peak;
+            
+            // Coefficients, updated at control rate
+            float f = 0.0f;
+            float q = 1.0f;
             
             void reset() {
-                low = band = high = notch = peak = 0.0f;
+                low = band = high = notch = peak = StereoFrame<float>();
             }
             
-            float process(float input, float cutoff, float resonance, float sampleRate, int filterType) {
-                float f = 2.0f * std::sin(juce::MathConstants<float>::pi * cutoff / sampleRate);
-                float q = 1.0f / resonance;
-                
-                low += f * band;
-                high = input - low - q * band;
-                band += f * high;
+            void setCoefficients(float cutoff, float resonance, float sampleRate) {
+                f = 2.0f * std::sin(juce::MathConstants<float>::pi * cutoff / sampleRate);
+                q = 1.0f / resonance;
+            }
+            
+            StereoFrame<float> process(StereoFrame<float> input, int filterType) {
+                low += StereoFrame<float>(f) * band;
+                high = input - low - StereoFrame<float>(q) * band;
+                band += StereoFrame<float>(f) * high;
                 notch = high + low;
                 peak = low - high;
                 
@@ -149,6 +175,7 @@ private:
             filterEnvStage = Off;
             filterEnvLevel = 0.0f;
             filterCutoff = 1000.0f;
+            pan = 0.0f;
             filter.reset();
         }
         
@@ -165,8 +192,29 @@ private:
         }
     };
     
-    // Synthesis engine
+    // Synthesis engines. synthEngine owns the voice filters and master effects;
+    // the spare engine only renders a mode while a mode crossfade needs two.
     std::unique_ptr<SynthEngine> synthEngine;
+    std::unique_ptr<SynthEngine> spareEngine;
+    SynthEngine* modeEngine = nullptr;  // Renders the active mode
+    SynthEngine* fadeEngine = nullptr;  // Renders the outgoing mode during a crossfade
+    
+    // Mode crossfade, audio thread only
+    struct ModeFade {
+        float incoming = 1.0f;
+        float outgoing = 0.0f;
+    };
+    void applyPendingModeChange();
+    void switchSynthMode(int requested);
+    void releaseIdleModes();
+    
+    // Message thread: frees the outgoing mode once its fade has been
+    // acknowledged, without waiting for the next selection
+    void timerCallback() override { releaseIdleModes(); }
+    ModeFade nextModeFade();
+    StereoFrame<float> generateModeSample(const ModeFade& fade, float phase, float frequency, int voiceIndex);
+    void engineNoteOn(int voiceIndex, float velocity);
+    void engineNoteOff(int voiceIndex);
     
     // MIDI handling helpers
     float noteToFrequency(int noteNumber);
@@ -176,14 +224,45 @@ private:
     Voice* findVoiceForNote(int noteNumber);
     
     // Envelope processing
-    void processEnvelope(Voice& voice, float attack, float decay, float sustain, float release);
+    struct EnvelopeRates {
+        float attack;
+        float decay;
+        float sustain;
+        float release;
+    };
+    EnvelopeRates makeEnvelopeRates(float attack, float decay, float sustain, float release) const;
+    void processEnvelope(Voice& voice, const EnvelopeRates& rates);
+    
+    // Both host precisions share one scheduler and render path
+    template <typename SampleType>
+    void processBlockInternal(juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages);
+    
+    // Renders one fixed-size sub-block into the sub-block buffer for SampleType
+    template <typename SampleType>
+    void processSubBlock(int numSamples);
     
     // Parameters
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     juce::AudioProcessorValueTreeState apvts;
+    StateSerializer stateSerializer;
+    std::vector<float> restoredState;  // Decode target for setStateInformation
+    PresetMorph presetMorph;
+    ParameterBindings params;
+    std::unique_ptr<PresetLibrary> presetLibrary;
     
     // Synthesis state
-    std::atomic<int> currentSynthMode{0};
+    std::atomic<int> requestedSynthMode{0};
+    
+    // Handshake for freeing per-mode state. The audio thread acknowledges
+    // each request serial and publishes the modes it may still render.
+    std::atomic<uint32_t> modeRequestSerial{0};
+    std::atomic<uint32_t> acknowledgedModeSerial{0};
+    std::atomic<uint32_t> renderingModeMask{1u};
+    int activeSynthMode = 0;
+    int fadeSynthMode = 0;
+    int fadeLength = 220;
+    int fadeSamplesRemaining = 0;
+    bool fadeEngineRetired = true;  // Idle since its fade ended, being scrubbed
     std::atomic<bool> isMonophonic{true};
     std::atomic<int> octaveShift{0};
     
@@ -196,21 +275,66 @@ private:
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedFreq;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothedGain;
     
+    // Internal processing granularity; control-rate work runs once per sub-block
+    static constexpr int subBlockSize = 32;
+    alignas(32) std::array<StereoFrame<float>, subBlockSize> subBlockBuffer {};
+    alignas(32) std::array<StereoFrame<double>, subBlockSize> subBlockBufferDouble {};
+    
+    template <typename SampleType>
+    std::array<StereoFrame<SampleType>, subBlockSize>& getSubBlockBuffer()
+    {
+        if constexpr (std::is_same_v<SampleType, double>)
+            return subBlockBufferDouble;
+        else
+            return subBlockBuffer;
+    }
+    
     // Voices for polyphonic mode
-    static constexpr int MAX_VOICES = 8;
+    static constexpr int MAX_VOICES = SynthEngine::MAX_VOICES;
     std::array<Voice, MAX_VOICES> voices;
+    std::array<StereoFrame<float>, MAX_VOICES> voicePanGains {}; // At the sub-block start
+    std::array<StereoFrame<float>, MAX_VOICES> voicePanSteps {}; // Per sample, towards the end
     
     // A4 reference for MIDI
     float a4Reference = 440.0f;
     
     // Monophonic tracking
     int currentMonoNote = -1;
+    float monoVelocity = 0.0f;
     float monoPhase = 0.0f;
+    Voice monoVoice; // Filter state for the mono path
     std::vector<int> heldMonoNotes; // Stack of held notes for proper mono behavior
     
-    // DC blocker for stability
-    float dcBlockerX1 = 0.0f;
-    float dcBlockerY1 = 0.0f;
+    // Fixed headroom for both the mono and poly paths; peaks are left to the
+    // master limiter
+    static constexpr float outputHeadroom = 0.5f;
+    
+    // Final stage, after master volume. Runs on every sub-block, silent or not.
+    MasterLimiter masterLimiter;
+    static_assert(subBlockSize <= MasterLimiter::maxBlockSize);
+    
+    // DC blocker for stability (state kept in double for both paths)
+    StereoFrame<double> dcBlockerX1;
+    StereoFrame<double> dcBlockerY1;
+    
+    template <typename SampleType>
+    StereoFrame<SampleType> applyDCBlocker(StereoFrame<SampleType> input)
+    {
+        const StereoFrame<double> dcBlockerCutoff = 0.995;
+        const StereoFrame<double> x(input);
+        const StereoFrame<double> output = x - dcBlockerX1 + dcBlockerCutoff * dcBlockerY1;
+        dcBlockerX1 = x;
+        dcBlockerY1 = output;
+        return StereoFrame<SampleType>(output);
+    }
+    
+    // Equal-power pan law, normalised to unity gain at centre
+    static StereoFrame<float> panGains(float pan)
+    {
+        const float angle = (std::clamp(pan, -1.0f, 1.0f) + 1.0f) * juce::MathConstants<float>::pi * 0.25f;
+        return { std::cos(angle) * juce::MathConstants<float>::sqrt2,
+                 std::sin(angle) * juce::MathConstants<float>::sqrt2 };
+    }
     
     // LFO for modulation
     struct LFO {
@@ -221,8 +345,19 @@ private:
         float process(float sampleRate) {
             phase += rate / sampleRate;
             if (phase >= 1.0f) phase -= 1.0f;
+            return getValue();
+        }
+        
+        float getValue() const {
             return std::sin(phase * 2.0f * juce::MathConstants<float>::pi) * depth;
         }
+        
+        // Jump ahead a whole sub-block and return the value there
+        float advance(int numSamples, float sampleRate) {
+            phase += rate * static_cast<float>(numSamples) / sampleRate;
+            phase -= std::floor(phase);
+            return getValue();
+        }
     } lfo1;
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SandWizardAudioProcessor)
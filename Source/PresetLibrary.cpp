@@ -0,0 +1,215 @@
+#include "PresetLibrary.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+PresetLibrary::PresetLibrary(const StateSerializer& stateSerializer)
+    : serializer(stateSerializer)
+{
+    // Slots are sized once so the audio thread never reallocates them
+    pendingPreset.fill(std::vector<float>(static_cast<size_t>(serializer.getNumParameters()),
+                                          std::numeric_limits<float>::quiet_NaN()));
+
+    scanner->attach(serializer);
+}
+
+PresetLibrary::~PresetLibrary()
+{
+    scanner->detach(serializer);
+}
+
+juce::StringArray PresetLibrary::getPresetNames() const
+{
+    return scanner->getPresetNames();
+}
+
+bool PresetLibrary::applyPreset(const juce::String& name)
+{
+    if (! getPresetValues(name, pendingPreset.getWriteBuffer()))
+        return false;
+
+    // An unread preset is simply replaced by the newer one
+    pendingPreset.publish();
+    return true;
+}
+
+bool PresetLibrary::getPresetValues(const juce::String& name, std::vector<float>& values) const
+{
+    return scanner->getPresetValues(name, values);
+}
+
+void PresetLibrary::applyPendingPreset()
+{
+    if (! pendingPreset.update())
+        return;
+
+    // The parameter ramps smooth the jump, so values are set in one go
+    const auto& values = pendingPreset.getReadBuffer();
+    for (int i = 0; i < serializer.getNumParameters(); i++)
+    {
+        const float value = values[static_cast<size_t>(i)];
+        if (! std::isnan(value))
+            serializer.getParameter(i).setValueNotifyingHost(value);
+    }
+}
+
+void PresetLibrary::savePreset(const juce::String& name, const juce::MemoryBlock& state)
+{
+    scanner->savePreset(name, state);
+}
+
+//==============================================================================
+PresetLibrary::Scanner::Scanner()
+    : juce::Thread("Preset Library"),
+      directory(juce::File::getSpecialLocation(juce::File::currentApplicationFile).getChildFile("Presets"))
+{
+    startThread();
+}
+
+PresetLibrary::Scanner::~Scanner()
+{
+    stopThread(2000);
+}
+
+void PresetLibrary::Scanner::attach(const StateSerializer& serializer)
+{
+    {
+        const juce::ScopedLock lock(decoderLock);
+        decoders.push_back(&serializer);
+    }
+
+    // Files the scan could not decode without a serializer are retried now
+    notify();
+}
+
+void PresetLibrary::Scanner::detach(const StateSerializer& serializer)
+{
+    const juce::ScopedLock lock(decoderLock);
+    decoders.erase(std::remove(decoders.begin(), decoders.end(), &serializer), decoders.end());
+}
+
+juce::StringArray PresetLibrary::Scanner::getPresetNames() const
+{
+    const juce::ScopedLock lock(indexLock);
+
+    juce::StringArray names;
+    for (const auto& entry : entries)
+    {
+        if (! entry.values.empty())
+            names.add(entry.name);
+    }
+    return names;
+}
+
+bool PresetLibrary::Scanner::getPresetValues(const juce::String& name, std::vector<float>& values) const
+{
+    const juce::ScopedLock lock(indexLock);
+
+    auto entry = std::find_if(entries.begin(), entries.end(),
+                              [&name](const Entry& e) { return e.name == name; });
+    if (entry == entries.end() || entry->values.empty())
+        return false;
+
+    values = entry->values;
+    return true;
+}
+
+void PresetLibrary::Scanner::savePreset(const juce::String& name, const juce::MemoryBlock& state)
+{
+    directory.createDirectory();
+    directory.getChildFile(name + fileExtension).replaceWithData(state.getData(), state.getSize());
+
+    // Pick the new file up straight away rather than at the next poll
+    notify();
+}
+
+void PresetLibrary::Scanner::run()
+{
+    while (! threadShouldExit())
+    {
+        scanDirectory();
+        wait(scanIntervalMs);
+    }
+}
+
+void PresetLibrary::Scanner::scanDirectory()
+{
+    std::vector<Entry> scanned;
+
+    if (directory.isDirectory())
+    {
+        auto files = directory.findChildFiles(juce::File::findFiles, false, juce::String("*") + fileExtension + ";*.xml");
+        files.sort();
+
+        for (const auto& file : files)
+        {
+            Entry entry;
+            entry.name = file.getFileNameWithoutExtension();
+            entry.file = file;
+            entry.modified = file.getLastModificationTime();
+            entry.size = file.getSize();
+            scanned.push_back(std::move(entry));
+        }
+    }
+
+    // Reuse decoded values for files that have not changed since the last scan
+    bool changed = false;
+    {
+        const juce::ScopedLock lock(indexLock);
+
+        changed = scanned.size() != entries.size();
+        for (auto& entry : scanned)
+        {
+            auto cached = std::find_if(entries.begin(), entries.end(),
+                                       [&entry](const Entry& e) { return e.file == entry.file; });
+
+            if (cached != entries.end() && cached->decoded
+                && cached->modified == entry.modified && cached->size == entry.size)
+            {
+                entry.values = cached->values;
+                entry.decoded = true;
+            }
+            else
+            {
+                changed = true;
+            }
+        }
+    }
+
+    if (! changed)
+        return;
+
+    // Decode outside the index lock; this is the slow part
+    for (auto& entry : scanned)
+    {
+        if (threadShouldExit())
+            return;
+
+        if (! entry.decoded)
+        {
+            // Files that fail to decode stay indexed with no values, so they
+            // are hidden but not retried until they change on disk
+            entry.decoded = decodePreset(entry.file, entry.values);
+        }
+    }
+
+    const juce::ScopedLock lock(indexLock);
+    entries.swap(scanned);
+}
+
+bool PresetLibrary::Scanner::decodePreset(const juce::File& file, std::vector<float>& values) const
+{
+    // Returns false only when no instance is attached to decode with
+    const juce::ScopedLock lock(decoderLock);
+    if (decoders.empty())
+        return false;
+
+    juce::MemoryBlock data;
+    const auto& serializer = *decoders.front();
+
+    // Older XML presets are migrated by the serializer
+    values.resize(static_cast<size_t>(serializer.getNumParameters()));
+    if (! file.loadFileAsData(data) || ! serializer.read(data.getData(), data.getSize(), values))
+        values.clear();
+    return true;
+}
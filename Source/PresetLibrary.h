@@ -0,0 +1,93 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "StateSerializer.h"
+#include "TripleBuffer.h"
+#include <vector>
+
+// Preset index kept off the audio and message threads. One background thread
+// per process watches the preset directory, decodes each file once into
+// normalised parameter values and swaps the finished index in under a lock;
+// every plugin instance reads the same index.
+// Applying a preset only copies cached values into the instance's triple
+// buffer; the audio thread picks them up at the next block boundary, so a
+// preset change never lands halfway through a block.
+class PresetLibrary
+{
+public:
+    explicit PresetLibrary(const StateSerializer& serializer);
+    ~PresetLibrary();
+
+    // Message thread. Names come from the cached index, so no disk access.
+    juce::StringArray getPresetNames() const;
+    bool applyPreset(const juce::String& name);
+    bool getPresetValues(const juce::String& name, std::vector<float>& values) const;
+    void savePreset(const juce::String& name, const juce::MemoryBlock& state);
+
+    // Audio thread: applies the most recently queued preset, if any.
+    // Lock-free and allocation free.
+    void applyPendingPreset();
+
+    const juce::File& getDirectory() const { return scanner->directory; }
+
+private:
+    // The shared index and the thread that keeps it current. Every instance
+    // has the same parameter layout, so any attached serializer can decode.
+    class Scanner : private juce::Thread
+    {
+    public:
+        Scanner();
+        ~Scanner() override;
+
+        void attach(const StateSerializer& serializer);
+        void detach(const StateSerializer& serializer);
+
+        juce::StringArray getPresetNames() const;
+        bool getPresetValues(const juce::String& name, std::vector<float>& values) const;
+        void savePreset(const juce::String& name, const juce::MemoryBlock& state);
+
+        const juce::File directory;
+
+    private:
+        struct Entry
+        {
+            juce::String name;
+            juce::File file;
+            juce::Time modified;
+            juce::int64 size = 0;
+            bool decoded = false;
+
+            // Normalised value per processor parameter, NaN where the preset
+            // does not store that parameter. Empty if the file did not decode.
+            std::vector<float> values;
+        };
+
+        void run() override;
+        void scanDirectory();
+        bool decodePreset(const juce::File& file, std::vector<float>& values) const;
+
+        // Serializers of the live instances; decoding holds the lock so an
+        // instance cannot go away mid-decode
+        juce::CriticalSection decoderLock;
+        std::vector<const StateSerializer*> decoders;
+
+        // Decoded presets, written by the scan thread and read by the message thread
+        juce::CriticalSection indexLock;
+        std::vector<Entry> entries;
+    };
+
+    const StateSerializer& serializer;
+    juce::SharedResourcePointer<Scanner> scanner;
+
+    // Decoded values on their way to the audio thread
+    TripleBuffer<std::vector<float>> pendingPreset;
+
+    // Presets are saved in the binary state format; .xml files from older
+    // versions are still listed
+    static constexpr const char* fileExtension = ".sandpreset";
+
+    // How often the scan thread checks the directory for changes
+    static constexpr int scanIntervalMs = 1000;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetLibrary)
+};
@@ -0,0 +1,133 @@
+#include "PresetMorph.h"
+#include <cmath>
+#include <limits>
+
+PresetMorph::PresetMorph(const StateSerializer& stateSerializer, juce::AudioProcessorValueTreeState& apvts)
+    : serializer(stateSerializer)
+{
+    const int numParameters = serializer.getNumParameters();
+
+    for (int i = 0; i < numParameters; i++)
+    {
+        auto& parameter = serializer.getParameter(i);
+        sources.push_back(apvts.getRawParameterValue(parameter.paramID));
+        discrete.push_back(parameter.isDiscrete() ? 1 : 0);
+        jassert(sources.back() != nullptr);
+
+        // The macro always follows its own automation
+        if (parameter.paramID == "presetMorph")
+            amountIndex = i;
+    }
+
+    jassert(amountIndex >= 0);
+    amountSource = sources[static_cast<size_t>(amountIndex)];
+
+    for (auto& slot : messageEndpoints.slots)
+    {
+        slot.values.assign(static_cast<size_t>(numParameters), std::numeric_limits<float>::quiet_NaN());
+    }
+    endpoints.fill(messageEndpoints);
+
+    values.resize(static_cast<size_t>(numParameters));
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = sources[i]->load();
+    }
+}
+
+void PresetMorph::setSlot(int slot, const std::vector<float>& slotValues)
+{
+    jassert(slot >= 0 && slot < numSlots);
+    jassert(slotValues.size() == values.size());
+
+    const juce::ScopedLock lock(slotLock);
+    auto& target = messageEndpoints.slots[static_cast<size_t>(slot)];
+    target.values = slotValues;
+    target.loaded = true;
+    publishEndpoints();
+}
+
+void PresetMorph::clearSlots()
+{
+    const juce::ScopedLock lock(slotLock);
+    for (auto& slot : messageEndpoints.slots)
+    {
+        slot.loaded = false;
+    }
+    publishEndpoints();
+}
+
+bool PresetMorph::isSlotLoaded(int slot) const
+{
+    const juce::ScopedLock lock(slotLock);
+    return messageEndpoints.slots[static_cast<size_t>(slot)].loaded;
+}
+
+void PresetMorph::getSlots(Slots& destination) const
+{
+    const juce::ScopedLock lock(slotLock);
+    destination = messageEndpoints.slots;
+}
+
+void PresetMorph::setSlots(const Slots& source)
+{
+    const juce::ScopedLock lock(slotLock);
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        jassert(source[i].values.size() == values.size());
+        messageEndpoints.slots[i] = source[i];
+    }
+    publishEndpoints();
+}
+
+void PresetMorph::publishEndpoints()
+{
+    // Same-sized vectors, so the copy reuses the slot's storage
+    endpoints.getWriteBuffer() = messageEndpoints;
+    endpoints.publish();
+}
+
+void PresetMorph::process()
+{
+    const bool endpointsChanged = endpoints.update();
+    const auto& current = endpoints.getReadBuffer();
+    const bool active = current.slots[0].loaded && current.slots[1].loaded;
+
+    // Interpolation only reruns when the macro moves or a slot changes
+    const float amount = amountSource->load(std::memory_order_relaxed);
+    const bool recompute = endpointsChanged || amount != lastAmount;
+    lastAmount = amount;
+
+    const auto& a = current.slots[0].values;
+    const auto& b = current.slots[1].values;
+
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        const bool morphed = active && ! std::isnan(a[i]) && ! std::isnan(b[i])
+                           && static_cast<int>(i) != amountIndex;
+
+        if (! morphed)
+        {
+            values[i] = sources[i]->load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (! recompute)
+            continue;
+
+        // Interpolating in the normalised domain follows each range's skew
+        const float normalised = discrete[i] != 0 ? (amount < 0.5f ? a[i] : b[i])
+                                                  : a[i] + (b[i] - a[i]) * amount;
+        values[i] = serializer.getParameter(static_cast<int>(i)).convertFrom0to1(normalised);
+    }
+}
+
+const float* PresetMorph::getValuePointer(const juce::String& parameterID) const
+{
+    for (int i = 0; i < serializer.getNumParameters(); i++)
+    {
+        if (serializer.getParameter(i).paramID == parameterID)
+            return &values[static_cast<size_t>(i)];
+    }
+    return nullptr;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "StateSerializer.h"
+#include "TripleBuffer.h"
+#include <array>
+#include <atomic>
+#include <vector>
+
+// The parameter values the audio thread renders with, rebuilt once per
+// sub-block. Normally these are the live parameter values. With presets
+// loaded into both the A and B slots, every parameter both presets store is
+// interpolated between them by the presetMorph macro instead; discrete
+// parameters switch over at the midpoint.
+class PresetMorph
+{
+public:
+    PresetMorph(const StateSerializer& serializer, juce::AudioProcessorValueTreeState& apvts);
+
+    static constexpr int numSlots = 2;
+    using Slots = std::array<StateSerializer::MorphSlot, numSlots>;
+
+    // Any thread but the audio thread; hosts may save and restore state off
+    // the message thread. values are normalised, one per parameter, NaN
+    // where the preset does not store the parameter.
+    void setSlot(int slot, const std::vector<float>& values);
+    void clearSlots();
+    bool isSlotLoaded(int slot) const;
+
+    // Whole-slot copies for the plugin state
+    void getSlots(Slots& destination) const;
+    void setSlots(const Slots& source);
+
+    // Audio thread, once per sub-block. Lock-free and allocation free.
+    void process();
+
+    // Plain value slot for a parameter, resolved once when binding
+    const float* getValuePointer(const juce::String& parameterID) const;
+
+private:
+    struct Endpoints
+    {
+        Slots slots;
+    };
+
+    void publishEndpoints();
+
+    const StateSerializer& serializer;
+    std::vector<std::atomic<float>*> sources;
+    std::vector<juce::uint8> discrete;
+    std::atomic<float>* amountSource = nullptr;
+    int amountIndex = -1;
+
+    // Writer side copy of the slots; the audio thread reads its own
+    juce::CriticalSection slotLock;
+    Endpoints messageEndpoints;
+    TripleBuffer<Endpoints> endpoints;
+
+    // Plain values read by ParameterBindings
+    std::vector<float> values;
+    float lastAmount = -1.0f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetMorph)
+};
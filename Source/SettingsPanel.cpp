@@ -150,11 +150,52 @@ void SettingsPanel::paint(juce::Graphics& g)
     g.setFont(juce::Font("Arial", 24.0f, juce::Font::bold));
     g.drawText("+", octaveUpButton, juce::Justification::centred);
     
+    // Preset morph slots
+    g.setFont(juce::Font("Arial", 14.0f, juce::Font::bold));
+    for (int slot = 0; slot < 2; slot++)
+    {
+        const auto& button = morphSlotButtons[slot];
+        const bool loaded = morphSlotNames[slot].isNotEmpty();
+        
+        g.setColour(morphSlotHovered[slot] ?
+                   juce::Colours::white.withAlpha(0.3f * opacity) :
+                   juce::Colours::white.withAlpha((loaded ? 0.2f : 0.1f) * opacity));
+        g.fillRect(button);
+        
+        g.setColour(morphSlotHovered[slot] ?
+                   juce::Colours::white.withAlpha(0.9f * opacity) :
+                   juce::Colours::white.withAlpha(0.6f * opacity));
+        g.drawRect(button, 2.0f);
+        
+        g.setColour(juce::Colours::white.withAlpha(opacity));
+        juce::String slotText = slot == 0 ? "MORPH A: " : "MORPH B: ";
+        slotText += loaded ? morphSlotNames[slot] : juce::String("EMPTY");
+        g.drawFittedText(slotText, button.toNearestInt().reduced(6, 0), juce::Justification::centred, 1);
+    }
+    
+    g.setColour(morphClearHovered ?
+               juce::Colours::white.withAlpha(0.3f * opacity) :
+               juce::Colours::white.withAlpha(0.15f * opacity));
+    g.fillRect(morphClearButton);
+    
+    g.setColour(morphClearHovered ?
+               juce::Colours::white.withAlpha(0.9f * opacity) :
+               juce::Colours::white.withAlpha(0.6f * opacity));
+    g.drawRect(morphClearButton, 2.0f);
+    
+    g.setColour(juce::Colours::white.withAlpha(opacity));
+    g.drawText("CLEAR", morphClearButton, juce::Justification::centred);
+    
     // Footer hint with minimal text
     g.setFont(juce::Font("Arial", 12.0f, juce::Font::plain));
     g.setColour(juce::Colours::white.withAlpha(0.8f * opacity));
     g.drawText("Settings appear after 0.5 seconds of silence", 
                getLocalBounds().removeFromBottom(30), juce::Justification::centred);
+    
+    // Memory readout in the footer's corner
+    g.setColour(juce::Colours::white.withAlpha(0.5f * opacity));
+    g.drawText("MEMORY: " + juce::String(static_cast<int>(memoryUsage / 1024)) + " KB",
+               getLocalBounds().removeFromBottom(30).reduced(20, 0), juce::Justification::centredRight);
 }
 
 void SettingsPanel::resized()
@@ -211,6 +252,24 @@ void SettingsPanel::mouseDown(const juce::MouseEvent& event)
         }
         return;
     }
+    
+    // Check preset morph slots
+    for (int slot = 0; slot < 2; slot++)
+    {
+        if (morphSlotButtons[slot].contains(point.toFloat()))
+        {
+            if (onMorphSlotClicked)
+                onMorphSlotClicked(slot);
+            return;
+        }
+    }
+    
+    if (morphClearButton.contains(point.toFloat()))
+    {
+        if (onMorphSlotsCleared)
+            onMorphSlotsCleared();
+        return;
+    }
 }
 
 void SettingsPanel::mouseMove(const juce::MouseEvent& event)
@@ -248,6 +307,38 @@ void SettingsPanel::mouseMove(const juce::MouseEvent& event)
     {
         repaint();
     }
+    
+    // Update preset morph hovers
+    bool morphHoverChanged = false;
+    for (int slot = 0; slot < 2; slot++)
+    {
+        bool hovered = morphSlotButtons[slot].contains(point.toFloat());
+        morphHoverChanged = morphHoverChanged || hovered != morphSlotHovered[slot];
+        morphSlotHovered[slot] = hovered;
+    }
+    
+    bool wasMorphClearHovered = morphClearHovered;
+    morphClearHovered = morphClearButton.contains(point.toFloat());
+    
+    if (morphHoverChanged || morphClearHovered != wasMorphClearHovered)
+    {
+        repaint();
+    }
+}
+
+void SettingsPanel::setMorphSlotName(int slot, const juce::String& name)
+{
+    morphSlotNames[slot] = name;
+    repaint();
+}
+
+void SettingsPanel::setMemoryUsage(size_t bytes)
+{
+    if (bytes == memoryUsage)
+        return;
+    
+    memoryUsage = bytes;
+    repaint();
 }
 
 void SettingsPanel::setVisible(bool shouldBeVisible, bool animate)
@@ -277,7 +368,7 @@ void SettingsPanel::layoutModeCards()
 {
     auto bounds = getLocalBounds();
     bounds.removeFromTop(190); // Space for repositioned title
-    bounds.removeFromBottom(100); // Space for mono/poly toggle and footer
+    bounds.removeFromBottom(150); // Space for mono/poly toggle, morph slots and footer
     
     // Layout mode cards in a grid
     const int cardsPerRow = 5;
@@ -351,6 +442,31 @@ void SettingsPanel::layoutModeCards()
         octaveButtonWidth,
         octaveHeight
     );
+    
+    // Position preset morph slots below the octave controls
+    float morphY = octaveY + 60.0f;
+    float morphSlotWidth = 200.0f;
+    float morphClearWidth = 80.0f;
+    float morphHeight = 40.0f;
+    float totalMorphWidth = morphSlotWidth * 2 + morphClearWidth + 20.0f; // spacing
+    float morphStartX = (getWidth() - totalMorphWidth) * 0.5f;
+    
+    for (int slot = 0; slot < 2; slot++)
+    {
+        morphSlotButtons[slot] = juce::Rectangle<float>(
+            morphStartX + slot * (morphSlotWidth + 10.0f),
+            morphY,
+            morphSlotWidth,
+            morphHeight
+        );
+    }
+    
+    morphClearButton = juce::Rectangle<float>(
+        morphStartX + morphSlotWidth * 2 + 20.0f,
+        morphY,
+        morphClearWidth,
+        morphHeight
+    );
 }
 
 int SettingsPanel::getModeCardAt(juce::Point<int> point)
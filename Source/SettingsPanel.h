@@ -25,10 +25,18 @@ public:
     bool isMonophonic() const { return monoMode; }
     int getOctaveShift() const { return octaveShift; }
     
+    // Preset name shown on a morph slot; empty marks the slot as unloaded
+    void setMorphSlotName(int slot, const juce::String& name);
+    
+    // Synth memory shown in the footer
+    void setMemoryUsage(size_t bytes);
+    
     // Callbacks
     std::function<void(int)> onModeSelected;
     std::function<void(bool)> onMonoPolyChanged;
     std::function<void(int)> onOctaveChanged;
+    std::function<void(int)> onMorphSlotClicked;
+    std::function<void()> onMorphSlotsCleared;
     
 private:
     // Mode card for visual selection
@@ -54,6 +62,15 @@ private:
     bool octaveDownHovered = false;
     bool octaveUpHovered = false;
     
+    // Preset morph A/B slots
+    std::array<juce::Rectangle<float>, 2> morphSlotButtons;
+    juce::Rectangle<float> morphClearButton;
+    std::array<bool, 2> morphSlotHovered {};
+    bool morphClearHovered = false;
+    std::array<juce::String, 2> morphSlotNames;
+    
+    size_t memoryUsage = 0;
+    
     // Current state
     int selectedMode = 0;
     bool monoMode = true;
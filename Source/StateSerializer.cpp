@@ -0,0 +1,336 @@
+#include "StateSerializer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <span>
+
+namespace
+{
+    constexpr juce::uint32 stateMagic = 0x647a5753;  // "SWzd" in file order
+    constexpr size_t headerSize = 8;
+
+    // Cymaglyph swept the test tone over a range in cents; the pitch LFO
+    // bends by up to 10% either way at full depth
+    float sweepRangeToPitchDepth(float cents)
+    {
+        const float halfRange = std::pow(2.0f, cents / 2400.0f) - 1.0f;
+        return std::clamp(halfRange / 0.1f, 0.0f, 1.0f);
+    }
+
+    float sweepOnToLfoTarget(float on)
+    {
+        return on > 0.5f ? 1.0f : 0.0f;  // Pitch or Off
+    }
+
+    // Schema 0 -> 1. freq, wave, gate and a4ref set the fixed tone that MIDI
+    // replaced; mount, accuracy, nodeEps and grainAmt fed the old renderer.
+    // Those have no counterpart and are dropped. IDs not listed carry over.
+    constexpr StateSerializer::Migration cymaglyphMigrations[] = {
+        { "gain",            "masterVolume", nullptr },
+        { "sweepOn",         "lfo1Target",   sweepOnToLfoTarget },
+        { "sweepRate",       "lfo1Rate",     nullptr },
+        { "sweepRangeCents", "lfo1Depth",    sweepRangeToPitchDepth },
+        { "freq",            nullptr,        nullptr },
+        { "wave",            nullptr,        nullptr },
+        { "gate",            nullptr,        nullptr },
+        { "a4ref",           nullptr,        nullptr },
+        { "mount",           nullptr,        nullptr },
+        { "accuracy",        nullptr,        nullptr },
+        { "nodeEps",         nullptr,        nullptr },
+        { "grainAmt",        nullptr,        nullptr },
+    };
+
+    // Schema 3 -> 4. oscDetune and oscPhase were unused and always stored 0
+    // until they became the unison detune and phase randomness, so older
+    // states drop them and the new defaults apply.
+    constexpr StateSerializer::Migration unisonMigrations[] = {
+        { "oscDetune", nullptr, nullptr },
+        { "oscPhase",  nullptr, nullptr },
+    };
+
+    // Indexed by the schema being upgraded from. Schema 1 -> 2 only changed
+    // the encoding and 2 -> 3 added the morph slots.
+    const std::span<const StateSerializer::Migration> schemaMigrations[] = {
+        cymaglyphMigrations,
+        {},
+        {},
+        unisonMigrations,
+    };
+    static_assert(std::size(schemaMigrations) == StateSerializer::currentVersion);
+
+    float readFloat(const juce::uint8* data)
+    {
+        const juce::uint32 bits = juce::ByteOrder::littleEndianInt(data);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    // Walks the entries of a binary state and reports where they end.
+    // Returns false on truncated data.
+    template <typename Visitor>
+    bool forEachBinaryValue(const juce::uint8* data, size_t sizeInBytes, Visitor&& visit,
+                            size_t* endPosition = nullptr)
+    {
+        const int count = juce::ByteOrder::littleEndianShort(data + 6);
+        size_t position = headerSize;
+
+        for (int i = 0; i < count; i++)
+        {
+            if (position + 1 > sizeInBytes)
+                return false;
+
+            const size_t idLength = data[position++];
+            if (position + idLength + 4 > sizeInBytes)
+                return false;
+
+            const auto* id = reinterpret_cast<const char*>(data + position);
+            position += idLength;
+
+            const float value = readFloat(data + position);
+            position += 4;
+
+            visit(i, id, idLength, value);
+        }
+
+        if (endPosition != nullptr)
+            *endPosition = position;
+        return true;
+    }
+}
+
+StateSerializer::StateSerializer(const juce::AudioProcessor& processor)
+{
+    for (auto* parameter : processor.getParameters())
+    {
+        if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(parameter))
+        {
+            parameters.push_back(ranged);
+            parameterIDs.push_back(ranged->paramID.toStdString());
+        }
+    }
+}
+
+void StateSerializer::write(juce::MemoryBlock& destData, std::span<const MorphSlot> morphSlots) const
+{
+    destData.reset();
+    juce::MemoryOutputStream stream(destData, false);
+
+    stream.writeInt(static_cast<int>(stateMagic));
+    stream.writeShort(static_cast<short>(currentVersion));
+    stream.writeShort(static_cast<short>(parameters.size()));
+
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        const auto& id = parameterIDs[i];
+        jassert(id.size() <= 255);
+
+        stream.writeByte(static_cast<char>(id.size()));
+        stream.write(id.data(), id.size());
+        stream.writeFloat(parameters[i]->convertFrom0to1(parameters[i]->getValue()));
+    }
+
+    jassert(morphSlots.size() <= 255);
+    stream.writeByte(static_cast<char>(morphSlots.size()));
+
+    for (const auto& slot : morphSlots)
+    {
+        stream.writeByte(slot.loaded ? 1 : 0);
+        if (! slot.loaded)
+            continue;
+
+        jassert(slot.values.size() == parameters.size());
+        for (size_t i = 0; i < parameters.size(); i++)
+        {
+            const float value = slot.values[i];
+            stream.writeFloat(std::isnan(value) ? value : parameters[i]->convertFrom0to1(value));
+        }
+    }
+}
+
+bool StateSerializer::read(const void* data, size_t sizeInBytes, std::vector<float>& values,
+                           std::span<MorphSlot> morphSlots) const
+{
+    jassert(values.size() == parameters.size());
+    std::fill(values.begin(), values.end(), std::numeric_limits<float>::quiet_NaN());
+
+    for (auto& slot : morphSlots)
+    {
+        slot.loaded = false;
+    }
+
+    const auto* bytes = static_cast<const juce::uint8*>(data);
+
+    if (sizeInBytes >= headerSize && juce::ByteOrder::littleEndianInt(bytes) == stateMagic)
+        return readBinary(bytes, sizeInBytes, values, morphSlots);
+
+    // Schema 1 states from hosts, then plain XML files
+    auto xml = juce::AudioProcessor::getXmlFromBinary(data, static_cast<int>(sizeInBytes));
+    if (xml == nullptr)
+        xml = juce::parseXML(juce::String::fromUTF8(static_cast<const char*>(data), static_cast<int>(sizeInBytes)));
+
+    return xml != nullptr && readXml(*xml, values);
+}
+
+template <typename EntryIndex>
+bool StateSerializer::readMorphSlots(const juce::uint8* data, size_t sizeInBytes, size_t position,
+                                     std::span<MorphSlot> morphSlots, EntryIndex&& entryIndex) const
+{
+    if (position + 1 > sizeInBytes)
+        return false;
+
+    // Slot values follow the parameter entries' order, so the entries are
+    // walked again to place them
+    const size_t slotSize = static_cast<size_t>(juce::ByteOrder::littleEndianShort(data + 6)) * 4;
+    const size_t numSlots = data[position++];
+
+    for (size_t slot = 0; slot < numSlots; slot++)
+    {
+        if (position + 1 > sizeInBytes)
+            return false;
+
+        if (data[position++] == 0)
+            continue;
+
+        if (position + slotSize > sizeInBytes)
+            return false;
+
+        if (slot < morphSlots.size())
+        {
+            auto& target = morphSlots[slot];
+            jassert(target.values.size() == parameters.size());
+            std::fill(target.values.begin(), target.values.end(), std::numeric_limits<float>::quiet_NaN());
+
+            const auto* slotValues = data + position;
+            forEachBinaryValue(data, sizeInBytes,
+                [this, &target, &entryIndex, slotValues](int i, const char* id, size_t idLength, float)
+                {
+                    const int index = entryIndex(i, id, idLength);
+                    const float value = readFloat(slotValues + static_cast<size_t>(i) * 4);
+                    if (index >= 0 && ! std::isnan(value))
+                        target.values[static_cast<size_t>(index)] = parameters[static_cast<size_t>(index)]->convertTo0to1(value);
+                });
+            target.loaded = true;
+        }
+        position += slotSize;
+    }
+    return true;
+}
+
+bool StateSerializer::readBinary(const juce::uint8* data, size_t sizeInBytes, std::vector<float>& values,
+                                 std::span<MorphSlot> morphSlots) const
+{
+    const int version = juce::ByteOrder::littleEndianShort(data + 4);
+
+    if (version == currentVersion)
+    {
+        size_t position = 0;
+        const bool complete = forEachBinaryValue(data, sizeInBytes,
+            [this, &values](int i, const char* id, size_t idLength, float value)
+            {
+                const int index = findParameter(id, idLength, i);
+                if (index >= 0)
+                    values[static_cast<size_t>(index)] = parameters[static_cast<size_t>(index)]->convertTo0to1(value);
+            }, &position);
+
+        return complete
+            && readMorphSlots(data, sizeInBytes, position, morphSlots,
+                              [this](int i, const char* id, size_t idLength) { return findParameter(id, idLength, i); });
+    }
+
+    // Other binary schemas are matched by name after migration
+    std::vector<LegacyValue> legacyValues;
+    size_t position = 0;
+    const bool complete = forEachBinaryValue(data, sizeInBytes,
+        [&legacyValues](int, const char* id, size_t idLength, float value)
+        {
+            legacyValues.push_back({ juce::String::fromUTF8(id, static_cast<int>(idLength)), value });
+        }, &position);
+
+    if (! complete)
+        return false;
+
+    applyLegacyValues(legacyValues, version, values);
+
+    // Morph slots arrived with schema 3; their entries follow the migrated IDs
+    if (version < 3)
+        return true;
+
+    return readMorphSlots(data, sizeInBytes, position, morphSlots,
+        [this, &legacyValues](int i, const char*, size_t)
+        {
+            const auto id = legacyValues[static_cast<size_t>(i)].id.toStdString();
+            return findParameter(id.data(), id.size(), -1);
+        });
+}
+
+bool StateSerializer::readXml(const juce::XmlElement& xml, std::vector<float>& values) const
+{
+    std::vector<LegacyValue> legacyValues;
+    bool hasCymaglyphParameters = false;
+
+    for (auto* child : xml.getChildIterator())
+    {
+        if (! child->hasTagName("PARAM"))
+            continue;
+
+        const auto id = child->getStringAttribute("id");
+        hasCymaglyphParameters = hasCymaglyphParameters || id == "freq";
+        legacyValues.push_back({ id, static_cast<float>(child->getDoubleAttribute("value")) });
+    }
+
+    // Neither XML schema carries a version; Cymaglyph is the only one with
+    // a freq parameter
+    applyLegacyValues(legacyValues, hasCymaglyphParameters ? 0 : 1, values);
+    return true;
+}
+
+void StateSerializer::applyLegacyValues(std::vector<LegacyValue>& legacyValues, int fromVersion,
+                                        std::vector<float>& values) const
+{
+    for (int version = std::max(fromVersion, 0); version < currentVersion; version++)
+    {
+        for (auto& legacy : legacyValues)
+        {
+            const auto& table = schemaMigrations[version];
+            auto migration = std::find_if(table.begin(), table.end(),
+                                          [&legacy](const Migration& m) { return legacy.id == m.fromID; });
+            if (migration == table.end())
+                continue;
+
+            legacy.id = migration->toID != nullptr ? juce::String(migration->toID) : juce::String();
+            if (migration->convert != nullptr)
+                legacy.value = migration->convert(legacy.value);
+        }
+    }
+
+    for (const auto& legacy : legacyValues)
+    {
+        const auto id = legacy.id.toStdString();
+        const int index = findParameter(id.data(), id.size(), -1);
+        if (index >= 0)
+            values[static_cast<size_t>(index)] = parameters[static_cast<size_t>(index)]->convertTo0to1(legacy.value);
+    }
+}
+
+int StateSerializer::findParameter(const char* id, size_t length, int expectedIndex) const
+{
+    auto matches = [&](size_t index)
+    {
+        const auto& candidate = parameterIDs[index];
+        return candidate.size() == length && std::memcmp(candidate.data(), id, length) == 0;
+    };
+
+    // States written by this layout list parameters in order
+    if (expectedIndex >= 0 && static_cast<size_t>(expectedIndex) < parameterIDs.size()
+        && matches(static_cast<size_t>(expectedIndex)))
+        return expectedIndex;
+
+    for (size_t i = 0; i < parameterIDs.size(); i++)
+    {
+        if (matches(i))
+            return static_cast<int>(i);
+    }
+    return -1;
+}
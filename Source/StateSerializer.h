@@ -0,0 +1,84 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <span>
+#include <string>
+#include <vector>
+
+// Compact binary plugin state with a schema version, plus readers for the
+// older XML states.
+//
+// Binary layout (little endian):
+//   uint32  magic 'SWzd'
+//   uint16  schema version
+//   uint16  parameter count
+//   per parameter: uint8 ID length, ID bytes (UTF-8), float32 plain value
+//   uint8   morph slot count
+//   per slot: uint8 loaded, then if loaded one float32 plain value per
+//             parameter entry above, NaN where the slot does not set it
+//
+// Values are stored unnormalised so a later change to a parameter's range
+// keeps its meaning. Older schemas are read into (ID, value) pairs and
+// upgraded one version at a time through the migration table.
+class StateSerializer
+{
+public:
+    // Schema history:
+    //   0  Cymaglyph parameter set (freq, wave, sweepOn...), XML
+    //   1  SandWizard APVTS XML via copyXmlToBinary
+    //   2  Binary layout above, without the morph slots
+    //   3  Binary layout above, with oscDetune and oscPhase still unused
+    //   4  Binary layout above
+    static constexpr int currentVersion = 4;
+
+    // A preset held in one of the A/B morph slots: one normalised value per
+    // parameter, NaN where the preset does not store that parameter
+    struct MorphSlot
+    {
+        std::vector<float> values;
+        bool loaded = false;
+    };
+
+    explicit StateSerializer(const juce::AudioProcessor& processor);
+
+    void write(juce::MemoryBlock& destData, std::span<const MorphSlot> morphSlots = {}) const;
+
+    // Decodes any supported state into one normalised value per parameter,
+    // NaN where the state does not store that parameter. values and each
+    // slot's values must already have getNumParameters() entries; slots the
+    // state does not hold are left unloaded. The current schema decodes
+    // without allocating. Returns false if the data is not a recognised state.
+    bool read(const void* data, size_t sizeInBytes, std::vector<float>& values,
+              std::span<MorphSlot> morphSlots = {}) const;
+
+    int getNumParameters() const { return static_cast<int>(parameters.size()); }
+    juce::RangedAudioParameter& getParameter(int index) const { return *parameters[static_cast<size_t>(index)]; }
+
+    // Parameter renames and conversions applied when upgrading from a schema
+    struct Migration
+    {
+        const char* fromID;
+        const char* toID;
+        float (*convert)(float);  // nullptr keeps the value
+    };
+
+private:
+    struct LegacyValue
+    {
+        juce::String id;
+        float value;
+    };
+
+    bool readBinary(const juce::uint8* data, size_t sizeInBytes, std::vector<float>& values,
+                    std::span<MorphSlot> morphSlots) const;
+    template <typename EntryIndex>
+    bool readMorphSlots(const juce::uint8* data, size_t sizeInBytes, size_t position,
+                        std::span<MorphSlot> morphSlots, EntryIndex&& entryIndex) const;
+    bool readXml(const juce::XmlElement& xml, std::vector<float>& values) const;
+    void applyLegacyValues(std::vector<LegacyValue>& legacyValues, int fromVersion, std::vector<float>& values) const;
+
+    int findParameter(const char* id, size_t length, int expectedIndex) const;
+
+    std::vector<juce::RangedAudioParameter*> parameters;
+    std::vector<std::string> parameterIDs;  // UTF-8, matched without building Strings
+};
@@ -1,5 +1,7 @@
 #include "SynthEngine.h"
+#include "ModeTables.h"
 #include <algorithm>
+#include <complex>
 
 // Keep the exact same color schemes as before
 const std::array<SynthEngine::ModeInfo, SynthEngine::NumModes> SynthEngine::modeInfoTable = {{
@@ -34,63 +36,321 @@ const std::array<SynthEngine::ModeInfo, SynthEngine::NumModes> SynthEngine::mode
         juce::Colour(255, 0, 255), juce::Colour(138, 43, 226), juce::Colour(255, 105, 180)} // Magenta to Violet
 }};
 
-SynthEngine::SynthEngine() : rng(std::random_device{}()), randomDist(-1.0f, 1.0f)
+// Operator numbering follows the DX7 manuals: index 0 is operator 1
+const std::array<SynthEngine::FMAlgorithm, 5> SynthEngine::fmAlgorithmTable = {{
+    // Three 2-op stacks, the classic electric piano layout (DX7 algorithm 5)
+    {{0b000010, 0, 0b001000, 0, 0b100000, 0}, 0b010101, 5},
+    
+    // 2-op stack plus 4-op cascade (DX7 algorithm 1)
+    {{0b000010, 0, 0b001000, 0b010000, 0b100000, 0}, 0b000101, 5},
+    
+    // Full cascade 6 -> 1
+    {{0b000010, 0b000100, 0b001000, 0b010000, 0b100000, 0}, 0b000001, 5},
+    
+    // One modulator feeding three carriers (DX7 algorithm 22)
+    {{0b000010, 0, 0b100000, 0b100000, 0b100000, 0}, 0b011101, 5},
+    
+    // All carriers, drawbar organ (DX7 algorithm 32)
+    {{0, 0, 0, 0, 0, 0}, 0b111111, 5}
+}};
+
+// Cheapest de-aliasing that is clean enough for each mode's drive stages
+const std::array<int, SynthEngine::NumModes> SynthEngine::defaultAntiAliasing = {{
+    AntiAliasADAA1,         // Crystalline
+    AntiAliasADAA1,         // Silk Pad
+    AntiAliasADAA1,         // Nebula Drift
+    AntiAliasADAA1,         // Liquid Bass
+    AntiAliasADAA1,         // Plasma Core: oversamples its own core, at 4x when Oversample4x is chosen
+    AntiAliasADAA1,         // Cloud Nine
+    AntiAliasADAA1,         // Quantum Flux
+    AntiAliasADAA1,         // Crystal Matrix
+    AntiAliasADAA1,         // Solar Wind
+    AntiAliasADAA1          // Void Resonance
+}};
+
+SynthEngine::SharedTables::SharedTables()
 {
-    // Initialize professional wavetables
-    wavetable.initialize();
+    // Tabulate shaper antiderivatives for ADAA
+    shaperTables[ShapeAnalogSaturate].build(analogSaturate);
+    
+    // Precompute additive synthesis kernel
+    AdditiveOscillator::buildKernel(additiveKernel);
     
+    MinBlep::build(minBlep);
+}
+
+SynthEngine::SynthEngine() : rng(std::random_device{}()), randomDist(-1.0f, 1.0f)
+{
     // Initialize reverb
     reverb.initialize();
     
+    modeArena.allocate();
+    modeAntiAliasing = defaultAntiAliasing;
+    
     // Initialize delay line
     delay.resize(static_cast<int>(44100 * 0.5f)); // 500ms max delay
     
-    // Initialize grain buffer with rich harmonic content
-    grainBuffer.resize(8192);
-    for (size_t i = 0; i < grainBuffer.size(); i++)
-    {
-        float t = static_cast<float>(i) / grainBuffer.size();
-        // Create lush texture
-        grainBuffer[i] = std::sin(2.0f * juce::MathConstants<float>::pi * t) * 0.5f;
-        grainBuffer[i] += std::sin(4.0f * juce::MathConstants<float>::pi * t) * 0.25f;
-        grainBuffer[i] += std::sin(6.0f * juce::MathConstants<float>::pi * t) * 0.125f;
-        // Apply envelope
-        grainBuffer[i] *= std::exp(-t * 3.0f) * (1.0f - t);
-    }
+    masterReverb.allpassPolarity = StereoFrame<double>(1.0, -1.0);
+    masterChorusRight.lfoPhase = 0.25f;
+    
+    // Three slightly detuned saws until the host sets the unison parameters
+    setUnisonParameters(3, 7.0f, 0.5f, 1.0f);
     
-    // Initialize layers with slight detuning for richness
-    for (int i = 0; i < 4; i++)
+    for (auto& oscillator : syncOscillators)
     {
-        layers[i].detune = (i - 1.5f) * 0.002f; // Slight detuning
-        layers[i].pan = (i - 1.5f) * 0.25f; // Stereo spread
+        oscillator.initialize(sharedTables->minBlep);
     }
     
     // Initialize FM operators for electric piano
     float ratios[] = {1.0f, 14.0f, 1.0f, 1.0f, 0.5f, 1.0f};
+    float levels[] = {1.0f, 0.12f, 0.8f, 0.35f, 0.6f, 0.25f};
+    float decays[] = {2.5f, 0.08f, 1.8f, 0.9f, 3.0f, 1.2f};
+    float sustains[] = {0.25f, 0.0f, 0.2f, 0.1f, 0.3f, 0.15f};
     for (size_t i = 0; i < fmOperators.size(); i++)
     {
-        fmOperators[i].frequency = ratios[i];
-        fmOperators[i].amplitude = 1.0f;
+        fmOperators[i].ratio = ratios[i];
+        fmOperators[i].amplitude = levels[i];
+        fmOperators[i].decay = decays[i];
+        fmOperators[i].sustain = sustains[i];
     }
+    fmOperators[5].feedback = 0.2f;
     
-    // Initialize strings for Dream Pluck
-    for (auto& string : strings)
+    for (auto& voice : fmVoices)
+    {
+        voice.setAlgorithm(fmAlgorithmTable[fmAlgorithm], fmOperators);
+    }
+}
+
+void SynthEngine::prepareMode(int modeIndex)
+{
+    switch (modeIndex)
+    {
+        case NebulaDrift:
+            if (!additiveVoices)
+            {
+                // Kernels come from the process-wide tables, the FFT is the engine's
+                additiveFFT = std::make_unique<juce::dsp::FFT>(AdditiveOscillator::FFT_ORDER);
+                additiveVoices = std::make_unique<std::array<AdditiveOscillator, MAX_VOICES>>();
+                for (auto& voice : *additiveVoices)
+                {
+                    voice.initialize(sharedTables->additiveKernel, *additiveFFT);
+                }
+            }
+            if (!spectralVoices)
+            {
+                // Frames are staggered across the voices so their FFTs do
+                // not all land on the same sample
+                spectralFFT = std::make_unique<juce::dsp::FFT>(SpectralProcessor::FFT_ORDER);
+                spectralVoices = std::make_unique<std::array<SpectralProcessor, MAX_VOICES>>();
+                for (int i = 0; i < MAX_VOICES; i++)
+                {
+                    (*spectralVoices)[i].initialize(DSPTables::spectralWindow, *spectralFFT,
+                                                    i * SpectralProcessor::HOP_SIZE / MAX_VOICES);
+                }
+            }
+            break;
+            
+        case Crystalline:
+            if (!crystallineModes)
+            {
+                // Struck off-centre, so the asymmetric modes sound too; each
+                // radial and angular step takes less of the strike
+                using namespace CymaglyphModes;
+                std::array<float, NUM_CIRCULAR_MODES> amplitudes;
+                for (int i = 0; i < NUM_CIRCULAR_MODES; i++)
+                {
+                    const auto& mode = circularModeTable[i];
+                    amplitudes[i] = 1.0f / (float(mode.k) * (1.0f + 0.5f * float(mode.n)));
+                }
+                
+                crystallineModes = std::make_unique<ModalVoices>();
+                for (auto& bank : *crystallineModes)
+                {
+                    bank.setModes(membraneRatios.data(), amplitudes.data(), NUM_CIRCULAR_MODES, 2.5f, 0.15f);
+                }
+            }
+            break;
+            
+        case CrystalMatrix:
+            if (!crystalMatrixModes)
+            {
+                // Each mode's shape at the strike point sets how hard it rings
+                using namespace CymaglyphModes;
+                constexpr float strikeX = 0.31f;
+                constexpr float strikeY = 0.43f;
+                std::array<float, NUM_SQUARE_MODES> amplitudes;
+                for (int i = 0; i < NUM_SQUARE_MODES; i++)
+                {
+                    const auto& mode = squareModeTable[i];
+                    const float pi = juce::MathConstants<float>::pi;
+                    amplitudes[i] = std::sin(float(mode.m) * pi * strikeX) * std::sin(float(mode.n) * pi * strikeY)
+                                  / std::sqrt(plateRatios[i]);
+                }
+                
+                crystalMatrixModes = std::make_unique<ModalVoices>();
+                for (auto& bank : *crystalMatrixModes)
+                {
+                    bank.setModes(plateRatios.data(), amplitudes.data(), NUM_SQUARE_MODES, 1.8f, 0.05f);
+                }
+            }
+            break;
+            
+        case VoidResonance:
+            if (!dimension)
+                dimension = std::make_unique<DimensionExpander>();
+            if (!voidMultiband)
+            {
+                // Sub, body and tendrils; the upper bands are driven less and
+                // sit lower to tilt the sum towards the lows
+                voidMultiband = std::make_unique<std::array<MultibandDynamics, MAX_VOICES>>();
+                for (auto& multiband : *voidMultiband)
+                {
+                    multiband.setCrossover(3, 120.0f, 2000.0f);
+                    multiband.setBand(0, 2.0f, 0.5f, 3.0f, 1.5f);
+                    multiband.setBand(1, 1.5f, 0.4f, 2.0f, 1.3f);
+                    multiband.setBand(2, 1.2f, 0.3f, 2.0f, 1.0f);
+                    multiband.setRelease(0.15f);
+                }
+            }
+            break;
+            
+        case SolarWind:
+            if (!solarDiffusion)
+                solarDiffusion = std::make_unique<std::array<DiffusionNetwork, MAX_VOICES>>();
+            break;
+            
+        default:
+            break;
+    }
+}
+
+void SynthEngine::releaseMode(int modeIndex)
+{
+    switch (modeIndex)
+    {
+        case NebulaDrift:
+            additiveVoices.reset();
+            spectralVoices.reset();
+            additiveFFT.reset();
+            spectralFFT.reset();
+            break;
+            
+        case Crystalline:
+            crystallineModes.reset();
+            break;
+            
+        case CrystalMatrix:
+            crystalMatrixModes.reset();
+            break;
+            
+        case VoidResonance:
+            dimension.reset();
+            voidMultiband.reset();
+            break;
+            
+        case SolarWind:
+            solarDiffusion.reset();
+            break;
+            
+        default:
+            break;
+    }
+}
+
+bool SynthEngine::isModePrepared(int modeIndex) const
+{
+    switch (modeIndex)
+    {
+        case NebulaDrift:   return additiveVoices != nullptr && spectralVoices != nullptr;
+        case Crystalline:   return crystallineModes != nullptr;
+        case CrystalMatrix: return crystalMatrixModes != nullptr;
+        case VoidResonance: return dimension != nullptr && voidMultiband != nullptr;
+        case SolarWind:     return solarDiffusion != nullptr;
+        default:            return true;
+    }
+}
+
+void SynthEngine::prepareMasterEffects()
+{
+    // The delay must cover the full 2s Delay Time range
+    if (masterDelay.buffer.empty())
     {
-        string.setFrequency(440.0f, 44100.0f);
+        masterReverb.initialize();
+        masterDelay.resize(static_cast<int>(44100 * 2.0f) + 1);
     }
 }
 
+size_t SynthEngine::getMemoryUsage() const
+{
+    auto heapBytes = [](const auto& vector)
+    {
+        return vector.capacity() * sizeof(typename std::decay_t<decltype(vector)>::value_type);
+    };
+    auto reverbBytes = [&heapBytes](const auto& r)
+    {
+        size_t bytes = 0;
+        for (const auto& comb : r.combs) bytes += heapBytes(comb.buffer);
+        for (const auto& allpass : r.allpasses) bytes += heapBytes(allpass.buffer);
+        return bytes;
+    };
+    
+    // JUCE's FFT engines keep forward and inverse twiddle tables of one
+    // complex value per point; the exact layout depends on the backend
+    auto fftBytes = [](const std::unique_ptr<juce::dsp::FFT>& fft) -> size_t
+    {
+        if (fft == nullptr)
+            return 0;
+        return sizeof(juce::dsp::FFT) + 2 * static_cast<size_t>(fft->getSize()) * sizeof(std::complex<float>);
+    };
+    
+    size_t bytes = sizeof(*this);
+    bytes += reverbBytes(reverb) + reverbBytes(masterReverb);
+    bytes += heapBytes(delay.buffer) + heapBytes(masterDelay.buffer);
+    bytes += heapBytes(modeArena.storage);
+    
+    if (additiveVoices) bytes += sizeof(*additiveVoices);
+    if (spectralVoices) bytes += sizeof(*spectralVoices);
+    bytes += fftBytes(additiveFFT) + fftBytes(spectralFFT);
+    if (dimension) bytes += sizeof(*dimension);
+    if (voidMultiband) bytes += sizeof(*voidMultiband);
+    if (crystallineModes) bytes += sizeof(*crystallineModes);
+    if (crystalMatrixModes) bytes += sizeof(*crystalMatrixModes);
+    if (solarDiffusion) bytes += sizeof(*solarDiffusion);
+    
+    return bytes;
+}
+
 void SynthEngine::reset()
 {
+    // Off the audio thread, so everything the engine owns is cleared now
+    retireModeState();
+    resetModeState();
+    resetModeAllocations(~0u);
+    while (scrubModeState()) {}
+    
+    for (int lane = 0; lane < LadderFilterBank::LANES; lane++)
+    {
+        voiceLadders.resetLane(lane);
+    }
+    
+    masterReverb.clear();
+    masterDelay.clear();
+}
+
+void SynthEngine::resetModeState()
+{
+    // Constant time: buffers left dirty since the last retire clear on first use
+    if (modeStateUsed)
+        retireModeState();
+    
     // Reset all oscillator phases
     currentPhase = 0.0f;
     for (auto& layer : layers)
         layer.phase = 0.0f;
     
-    for (auto& op : fmOperators)
+    for (auto& voice : fmVoices)
     {
-        op.phase = 0.0f;
-        op.lastOutput = 0.0f;
+        voice.reset();
     }
     
     for (auto& grain : grains)
@@ -105,18 +365,17 @@ void SynthEngine::reset()
     
     // Reset per-mode state to prevent audio dropouts
     plasmaCoreBuffer = 0.0f;
-    combBuffer.fill(0);
     combIndex = 0;
-    quantumSyncPhase = 0.0f;
     quantumFrozenSample = 0.0f;
-    crystalPitchBuffer.fill(0);
+    for (auto& oscillator : syncOscillators)
+        oscillator.reset();
+    for (auto& core : plasmaCores)
+        core.reset();
+    for (auto& voice : bassVoices)
+        voice.reset();
     crystalPitchIndex = 0;
-    solarFrozenSpectrum.fill(0);
-    for (auto& buffer : solarDiffusionBuffer)
-    {
-        buffer.fill(0);
-    }
-    solarDiffusionIndex.fill(0);
+    
+    resetModeAllocations(renderModes);
     
     // Reset filters to prevent DC buildup
     for (auto& filter : filters)
@@ -128,15 +387,10 @@ void SynthEngine::reset()
         for (int i = 0; i < 4; i++)
         {
             filter.stage[i] = 0;
-            filter.delay[i] = 0;
         }
+        filter.ladderCountdown = 0;
     }
     
-    // Reset effects
-    reverb.initialize();
-    delay.buffer.clear();
-    delay.writeIndex = 0;
-    
     // Reset phaser
     phaser.lfoPhase = 0.0f;
     phaser.allpassStates.fill(0);
@@ -146,15 +400,123 @@ void SynthEngine::reset()
     bitCrusher.sampleCounter = 0;
 }
 
-float SynthEngine::generateSample(float phase, float frequency, int modeIndex)
+void SynthEngine::resetModeAllocations(uint32_t modeMask)
+{
+    if ((modeMask & (1u << VoidResonance)) != 0 && voidMultiband)
+    {
+        for (auto& multiband : *voidMultiband)
+            multiband.reset();
+    }
+    
+    // A bank's pointer is only read once its mode is known to be in the
+    // mask; the message thread may be writing the others
+    const std::pair<int, std::unique_ptr<ModalVoices>*> banks[] = {
+        { Crystalline, &crystallineModes },
+        { CrystalMatrix, &crystalMatrixModes }
+    };
+    
+    for (const auto& [mode, voices] : banks)
+    {
+        if ((modeMask & (1u << mode)) == 0 || *voices == nullptr)
+            continue;
+        for (auto& bank : **voices)
+            bank.reset();
+    }
+}
+
+void SynthEngine::retireModeState()
+{
+    modeArena.invalidate();
+    modeStateUsed = false;
+    scrubIndex = 0;
+}
+
+bool SynthEngine::scrubModeState()
+{
+    auto scrub = [this](auto& state, uint32_t& stamp)
+    {
+        const bool stale = stamp != 0 && stamp != modeArena.generation;
+        freshState(state, stamp);
+        return stale;
+    };
+    
+    // The reverb, the delay, each arena region, then each voice's shaper
+    // stages. Per-mode allocations are left to first use: the message
+    // thread may be releasing them while this engine is idle.
+    constexpr int numItems = 2 + ModeStateArena::NumRegions + MAX_VOICES;
+    while (scrubIndex < numItems)
+    {
+        const int item = scrubIndex++;
+        bool cleared = false;
+        
+        if (item == 0)
+        {
+            cleared = scrub(reverb, reverbGeneration);
+        }
+        else if (item == 1)
+        {
+            cleared = scrub(delay, delayGeneration);
+        }
+        else if (item < 2 + ModeStateArena::NumRegions)
+        {
+            const auto region = static_cast<ModeStateArena::Region>(item - 2);
+            cleared = modeArena.regionGeneration[region] != modeArena.generation;
+            modeArena.acquire(region);
+        }
+        else
+        {
+            const int voice = item - 2 - ModeStateArena::NumRegions;
+            for (int slot = 0; slot < NumShaperSlots; slot++)
+                cleared = scrub(shaperStages[voice][slot], shaperGeneration[voice][slot]) || cleared;
+        }
+        
+        if (cleared)
+            return true;
+    }
+    return false;
+}
+
+void SynthEngine::noteOn(int voiceIndex, float noteVelocity)
 {
+    if (voiceIndex < 0 || voiceIndex >= MAX_VOICES) return;
+    
+    fmVoices[voiceIndex].noteOn(fmOperators, noteVelocity);
+    unison[voiceIndex].restart(unisonPhaseRandomness, rng);
+    plasmaCores[voiceIndex].restart();
+    bassVoices[voiceIndex].restart();
+    if (rendersMode(Crystalline) && crystallineModes)
+        (*crystallineModes)[voiceIndex].strike(noteVelocity);
+    if (rendersMode(CrystalMatrix) && crystalMatrixModes)
+        (*crystalMatrixModes)[voiceIndex].strike(noteVelocity);
+    voiceLadders.resetLane(voiceIndex * 2);
+    voiceLadders.resetLane(voiceIndex * 2 + 1);
+}
+
+void SynthEngine::noteOff(int voiceIndex)
+{
+    if (voiceIndex < 0 || voiceIndex >= MAX_VOICES) return;
+    
+    fmVoices[voiceIndex].noteOff();
+}
+
+StereoFrame<float> SynthEngine::generateSample(float phase, float frequency, int modeIndex, int voiceIndex)
+{
+    currentVoice = juce::jlimit(0, MAX_VOICES - 1, voiceIndex);
+    currentMode = juce::jlimit(0, NumModes - 1, modeIndex);
+    
+    // Per-mode state is never allocated here
+    if (!isModePrepared(currentMode))
+        return 0.0f;
+    modeStateUsed = true;
+    
     // Track frequency changes
     if (std::abs(frequency - lastFrequency) > 0.1f)
     {
         lastFrequency = frequency;
     }
     
-    float output = 0.0f;
+    // Mono modes broadcast to both channels
+    StereoFrame<float> output;
     
     switch (modeIndex)
     {
@@ -171,19 +533,19 @@ float SynthEngine::generateSample(float phase, float frequency, int modeIndex)
         default:             output = 0.0f; break;
     }
     
-    // Professional limiting
-    return softClip(output);
+    // Modes leave their peaks unclipped; the processor's master limiter
+    // catches them across the summed voices
+    return output;
 }
 
 float SynthEngine::generateCrystalline(float phase, float frequency)
 {
-    // Keep the original Crystalline sound
-    float output = wavetable.generate(phase);
+    // Keep the original Crystalline sound, with an FM tine body on top
+    float output = wavetable.generate(phase) * 0.5f;
+    output += fmVoices[currentVoice].process(frequency) * 0.5f;
     
-    // Add inharmonic partials for bell-like quality
-    output += std::sin(2.0f * juce::MathConstants<float>::pi * phase * 2.76f) * 0.15f;
-    output += std::sin(2.0f * juce::MathConstants<float>::pi * phase * 5.4f) * 0.1f;
-    output += std::sin(2.0f * juce::MathConstants<float>::pi * phase * 8.93f) * 0.05f;
+    // Struck membrane modes give the bell its inharmonic partials
+    output += (*crystallineModes)[currentVoice].process(frequency) * 0.5f;
     
     // Filter for smoothness
     filters[0].setStateVariable(frequency * 4.0f, 2.0f, 44100.0f);
@@ -193,32 +555,29 @@ float SynthEngine::generateCrystalline(float phase, float frequency)
     output = chorus.process(output);
     
     // Subtle reverb
-    float reverbSignal = reverb.process(output * 0.3f);
+    float reverbSignal = freshState(reverb, reverbGeneration).process(output * 0.3f);
     
-    return softClip((output * 0.6f + reverbSignal * 0.4f) * 0.7f); // Normalized
+    return (output * 0.6f + reverbSignal * 0.4f) * 0.7f; // Normalized
 }
 
-float SynthEngine::generateSilkPad(float phase, float frequency)
+StereoFrame<float> SynthEngine::generateSilkPad(float phase, float frequency)
 {
-    // 3-layer detuned saw waves for lush pad
+    // Detuned unison saws for a lush pad. The stack is split into mid and
+    // side; the mid runs through the chain and the side is added back at
+    // the end.
+    const auto saws = unison[currentVoice].processSaw(frequency);
     float output = 0.0f;
     
-    // Update layer phases
+    // Formant filtering for warmth
     for (int i = 0; i < 3; i++)
     {
-        layers[i].phase += (frequency * (1.0f + layers[i].detune)) / 44100.0f;
-        if (layers[i].phase >= 1.0f) layers[i].phase -= 1.0f;
-        
-        // Generate saw wave
-        float saw = 2.0f * layers[i].phase - 1.0f;
-        
-        // Apply formant filtering for warmth
         filters[i].setStateVariable(800.0f + i * 200.0f, 3.0f, 44100.0f);
-        saw = filters[i].processBandpass(saw);
-        
-        output += saw * (1.0f / (i + 1));
+        output += filters[i].processBandpass(saws.mid()) * (1.0f / (i + 1));
     }
     
+    silkSideFormant.setStateVariable(1000.0f, 3.0f, 44100.0f);
+    float side = silkSideFormant.processBandpass((saws.left - saws.right) * 0.5f);
+    
     // Warm filter sweep
     float cutoff = 2000.0f + std::sin(phase * 0.1f) * 1000.0f;
     filters[3].setMoogLadder(cutoff, 0.3f, 44100.0f);
@@ -233,12 +592,49 @@ float SynthEngine::generateSilkPad(float phase, float frequency)
     // Lush reverb
     reverb.roomSize = 0.8f;
     reverb.wetLevel = 0.4f;
-    float reverbSignal = reverb.process(output);
+    float reverbSignal = freshState(reverb, reverbGeneration).process(output);
     
     // Analog warmth
-    output = analogSaturate(output * 0.5f + reverbSignal * 0.5f);
+    output = shape(SlotSaturate, ShapeAnalogSaturate, output * 0.5f + reverbSignal * 0.5f);
+    
+    // M/S decode
+    const float mid = output * 0.7f * velocity; // Normalized
+    side *= 0.7f * velocity;
+    return { mid + side, mid - side };
+}
+
+void SynthEngine::setUnisonParameters(int subVoices, float detuneCents, float spread, float phaseRandomness)
+{
+    subVoices = juce::jlimit(1, UnisonOscillator::MAX_SUB_VOICES, subVoices);
+    detuneCents = juce::jlimit(0.0f, 100.0f, detuneCents);
+    spread = juce::jlimit(0.0f, 1.0f, spread);
+    unisonPhaseRandomness = juce::jlimit(0.0f, 1.0f, phaseRandomness);
+    
+    // Gains and ratios only change with the settings
+    if (subVoices == unisonSubVoices && detuneCents == unisonDetune && spread == unisonSpread)
+        return;
+    
+    unisonSubVoices = subVoices;
+    unisonDetune = detuneCents;
+    unisonSpread = spread;
+    
+    for (auto& voice : unison)
+    {
+        voice.configure(subVoices, detuneCents, spread);
+    }
+}
+
+void SynthEngine::setFMAlgorithm(int algorithm)
+{
+    algorithm = juce::jlimit(0, static_cast<int>(fmAlgorithmTable.size()) - 1, algorithm);
+    if (algorithm == fmAlgorithm)
+        return;
     
-    return softClip(output * 0.7f * velocity); // Normalized
+    fmAlgorithm = algorithm;
+    for (auto& voice : fmVoices)
+    {
+        voice.setAlgorithm(fmAlgorithmTable[fmAlgorithm], fmOperators);
+    }
 }
 
 float SynthEngine::generateNebulaDrift(float phase, float frequency)
@@ -255,7 +651,7 @@ float SynthEngine::generateNebulaDrift(float phase, float frequency)
     // Layer 2: Sub-harmonic drone
     float subPhase = phase * 0.5f;
     float subOsc = std::sin(subPhase * 2.0f * M_PI);
-    subOsc = analogSaturate(subOsc * 2.0f) * 0.3f;
+    subOsc = shape(SlotSaturate, ShapeAnalogSaturate, subOsc * 2.0f) * 0.3f;
     
     // Layer 3: High frequency shimmer particles
     float shimmer = 0.0f;
@@ -267,22 +663,28 @@ float SynthEngine::generateNebulaDrift(float phase, float frequency)
     }
     shimmer *= lfos[1].process() * 0.15f;
     
-    // Apply Shepard tone morphing
+    // Apply Shepard tone morphing to the additive partials at control rate
     float shepardPos = lfos[2].process() * 0.5f + 0.5f;
-    float harmonicArray[32];
-    for (int i = 0; i < 32; i++)
+    auto& additive = freshState((*additiveVoices)[currentVoice], (*additiveVoices)[currentVoice].stateGeneration);
+    if (additive.isControlTick())
     {
-        harmonicArray[i] = harmonics[i].amplitude;
+        updateHarmonics(frequency, NebulaDrift);
+        
+        // Every harmonic below Nyquist. Notes under about 310 Hz carry enough
+        // partials for the inverse-FFT renderer; higher notes use the bank.
+        const int numPartials = juce::jlimit(1, AdditiveOscillator::MAX_PARTIALS,
+                                             static_cast<int>(44100.0f * 0.45f / std::max(frequency, 1.0f)));
+        std::array<float, AdditiveOscillator::MAX_PARTIALS> partialAmplitudes;
+        for (int i = 0; i < numPartials; i++)
+        {
+            partialAmplitudes[i] = harmonics[i].amplitude;
+        }
+        applyShepardTone(partialAmplitudes.data(), numPartials, shepardPos);
+        additive.setPartials(partialAmplitudes.data(), numPartials);
     }
-    applyShepardTone(harmonicArray, 32, shepardPos);
     
     // Mix spectral components
-    float spectralMix = 0.0f;
-    for (int i = 0; i < 8; i++)
-    {
-        float harmPhase = phase * (i + 1);
-        spectralMix += std::sin(harmPhase * 2.0f * M_PI) * harmonicArray[i];
-    }
+    float spectralMix = additive.process(frequency);
     
     float output = wavetableOut * 0.4f + subOsc + shimmer + spectralMix * 0.2f;
     
@@ -291,51 +693,43 @@ float SynthEngine::generateNebulaDrift(float phase, float frequency)
     filters[0].setStateVariable(formantFreq, 3.0f, 44100.0f);
     output = filters[0].processBandpass(output);
     
+    // Spectral cloud: blur toward the long-term spectrum with drifting dispersion
+    auto& spectral = freshState((*spectralVoices)[currentVoice], (*spectralVoices)[currentVoice].stateGeneration);
+    spectral.morphPosition = 0.7f;
+    spectral.warpAmount = warpAmount;
+    spectral.shiftAmount = 2.0f; // Octave shimmer
+    output = output * 0.7f + spectral.process(output) * 0.3f;
+    
     // Multi-tap granular delay
     delay.time = 0.1f + lfos[0].process() * 0.05f;
     delay.feedback = 0.7f;
     delay.mix = 0.4f;
-    output = delay.process(output);
+    output = freshState(delay, delayGeneration).process(output);
     
     // Infinite reverb
     reverb.roomSize = 0.95f;
     reverb.damping = 0.3f;
     reverb.wetLevel = 0.5f;
-    output = output * 0.5f + reverb.process(output) * 0.5f;
+    output = output * 0.5f + freshState(reverb, reverbGeneration).process(output) * 0.5f;
     
-    return softClip(output * 0.5f); // Normalized
+    return output * 0.5f; // Normalized
 }
 
 float SynthEngine::generateLiquidBass(float phase, float frequency)
 {
     // Dual oscillator with sub-harmonic synthesis
+    juce::ignoreUnused(frequency);
+    auto& voice = bassVoices[currentVoice];
     
-    // Main oscillator - sine for fundamental
-    float fundamental = std::sin(2.0f * juce::MathConstants<float>::pi * phase);
-    
-    // Sub oscillator - one octave down
-    layers[0].phase += (frequency * 0.5f) / 44100.0f;
-    if (layers[0].phase >= 1.0f) layers[0].phase -= 1.0f;
-    float sub = std::sin(2.0f * juce::MathConstants<float>::pi * layers[0].phase);
-    
-    // Second harmonic for presence
-    float second = std::sin(4.0f * juce::MathConstants<float>::pi * phase) * 0.3f;
-    
-    // Mix oscillators
-    float output = fundamental * 0.6f + sub * 0.5f + second * 0.2f;
+    // Fundamental, phase-locked sub one octave down and second harmonic
+    float output = voice.oscillate(phase);
     
     // Spectral warping for movement (Vital-inspired)
-    float warp = std::pow(std::abs(output), 1.5f) * (output > 0 ? 1.0f : -1.0f);
+    float warp = output * std::sqrt(std::abs(output));
     output = mixLayers(output, warp, 0.3f);
     
     // Filter with envelope following
-    float envFollow = std::abs(output) * 2.0f + 0.5f;
-    float cutoff = 200.0f + envFollow * 500.0f;
-    filters[0].setMoogLadder(cutoff, 0.4f + velocity * 0.3f, 44100.0f);
-    output = filters[0].processMoogLadder(output);
-    
-    // Compression for punch
-    output = analogSaturate(output * 2.0f) * 0.5f;
+    output = voice.filter(output, 0.4f + velocity * 0.3f);
     
     // Subtle chorus for width
     chorus.rate = 0.1f;
@@ -343,72 +737,41 @@ float SynthEngine::generateLiquidBass(float phase, float frequency)
     chorus.mix = 0.1f;
     output = chorus.process(output);
     
-    return softClip(output * 0.7f); // Normalized
+    return output * 0.35f; // Normalized
 }
 
 float SynthEngine::generatePlasmaCore(float phase, float frequency)
 {
     // Aggressive morphing metallic textures with harmonic distortion
-    
-    // Layer 1: Dual wavetables with FM cross-modulation
-    float wt1 = wavetable.generate(phase);
-    float wt2Phase = phase * 1.01f; // Slight detune
-    float wt2 = wavetable.generate(wt2Phase);
-    
-    // FM cross-modulation
-    float modDepth = 0.5f + lfos[0].process() * 0.3f;
-    float fm1 = std::sin((phase + wt2 * modDepth) * 2.0f * M_PI);
-    float fm2 = std::sin((wt2Phase + wt1 * modDepth) * 2.0f * M_PI);
-    
-    // Layer 2: Harmonic saturator with odd/even emphasis
-    float oddHarmonics = 0.0f;
-    float evenHarmonics = 0.0f;
-    
-    for (int i = 1; i <= 9; i += 2) // Odd harmonics
-    {
-        float harmPhase = phase * float(i);
-        oddHarmonics += std::sin(harmPhase * 2.0f * M_PI) / float(i);
-    }
-    
-    for (int i = 2; i <= 8; i += 2) // Even harmonics
-    {
-        float harmPhase = phase * float(i);
-        evenHarmonics += std::sin(harmPhase * 2.0f * M_PI) / float(i * 2);
-    }
-    
-    // Morph between odd and even harmonics
-    float morphPos = lfos[1].process() * 0.5f + 0.5f;
-    float harmonicMix = oddHarmonics * (1.0f - morphPos) + evenHarmonics * morphPos;
-    
-    // Layer 3: Resonant feedback network
-    float resonantSignal = fm1 + plasmaCoreBuffer * 0.3f;
+    juce::ignoreUnused(phase);
+    
+    // Every nonlinear stage runs in the oversampled core
+    const int oversampling = modeAntiAliasing[PlasmaCore] == AntiAliasOversample4x ? 4 : 2;
+    const float modDepth = 0.5f + lfos[0].process() * 0.3f;
+    const float morphPos = lfos[1].process() * 0.5f + 0.5f;
+    const float warpAmount = 1.0f + lfos[2].process();
+    const float core = plasmaCores[currentVoice].process(oversampling, frequency / 44100.0f,
+                                                         modDepth, morphPos, warpAmount);
+    
+    // Resonant feedback network
+    float resonantSignal = core + plasmaCoreBuffer * 0.3f;
     filters[0].setMoogLadder(frequency * 2.5f, 3.5f, 44100.0f);
     resonantSignal = filters[0].processMoogLadder(resonantSignal);
     plasmaCoreBuffer = resonantSignal * 0.7f;
     
-    // Mix layers
-    float output = fm1 * 0.3f + fm2 * 0.3f + harmonicMix * 0.2f + resonantSignal * 0.2f;
-    
-    // Spectral warping
-    float warpAmount = 1.0f + lfos[2].process();
-    output = spectralWarp(output, warpAmount);
-    
-    // Tube saturation
-    output = analogSaturate(output * 2.0f) * 0.7f;
+    float output = core * 0.8f + resonantSignal * 0.2f;
     
     // Comb filtering for metallic resonance  
     int combDelay = int(frequency / 100.0f);
     combDelay = std::max(1, std::min(255, combDelay));
     
+    float* combBuffer = modeArena.acquire(ModeStateArena::CombRegion);
     float combOut = combBuffer[(combIndex - combDelay + 256) % 256];
     combBuffer[combIndex] = output + combOut * 0.4f;
     combIndex = (combIndex + 1) % 256;
     output = output + combOut * 0.3f;
     
-    // Aggressive compression
-    output = hardClip(output * 1.5f) * 0.6f;
-    
-    return softClip(output * 0.7f * velocity); // Normalized
+    return output * velocity; // Normalized
 }
 
 float SynthEngine::generateCloudNine(float phase, float frequency)
@@ -438,15 +801,15 @@ float SynthEngine::generateCloudNine(float phase, float frequency)
     reverb.roomSize = 0.9f;
     reverb.damping = 0.6f;
     reverb.wetLevel = 0.5f;
-    float reverbSignal = reverb.process(output);
+    float reverbSignal = freshState(reverb, reverbGeneration).process(output);
     
     // Smooth delay
     delay.time = 0.25f;
     delay.feedback = 0.3f;
     delay.mix = 0.2f;
-    float delaySignal = delay.process(output);
+    float delaySignal = freshState(delay, delayGeneration).process(output);
     
-    return softClip((output * 0.4f + reverbSignal * 0.4f + delaySignal * 0.2f) * 0.7f);
+    return (output * 0.4f + reverbSignal * 0.4f + delaySignal * 0.2f) * 0.7f; // Normalized
 }
 
 float SynthEngine::generateQuantumFlux(float phase, float frequency)
@@ -465,13 +828,13 @@ float SynthEngine::generateQuantumFlux(float phase, float frequency)
         harmonicContent += std::sin(harmPhase * 2.0f * M_PI) * harmAmp;
     }
     
-    // Smooth sync oscillator
-    quantumSyncPhase += (frequency * 1.5f) / 44100.0f;
-    if (quantumSyncPhase >= 1.0f) quantumSyncPhase -= 1.0f;
-    float syncOsc = std::sin(quantumSyncPhase * 2.0f * M_PI) * 0.3f;
+    // Hard-synced saw, the slave sweeping with the formant
+    const float sweep = std::sin(phase * 0.1f);
+    const float masterIncrement = frequency / 44100.0f;
+    float syncOsc = syncOscillators[currentVoice].process(masterIncrement, masterIncrement * (2.0f + sweep * 0.5f)) * 0.3f;
     
     // Formant filter with smooth modulation
-    float formantFreq = 900.0f + std::sin(phase * 0.1f) * 300.0f;
+    float formantFreq = 900.0f + sweep * 300.0f;
     filters[0].setStateVariable(formantFreq, 3.0f, 44100.0f);
     syncOsc = filters[0].processBandpass(syncOsc);
     
@@ -484,65 +847,22 @@ float SynthEngine::generateQuantumFlux(float phase, float frequency)
     output = phaser.process(output);
     
     // Gentle saturation
-    output = analogSaturate(output);
+    output = shape(SlotSaturate, ShapeAnalogSaturate, output);
     
-    return softClip(output * 0.7f * velocity);
+    return output * 0.7f * velocity; // Normalized
 }
 
 float SynthEngine::generateCrystalMatrix(float phase, float frequency)
 {
     // Glassy resonant plucks with harmonic cascades
+    juce::ignoreUnused(phase);
     
-    // Layer 1: Karplus-Strong with harmonic excitation
-    float excitation = 0.0f;
-    if (phase < 0.01f)
-    {
-        // Harmonic excitation burst
-        for (int h = 1; h <= 5; h++)
-        {
-            excitation += std::sin(randomFloat() * M_PI) / float(h);
-        }
-        excitation *= velocity;
-        
-        for (auto& string : strings)
-        {
-            string.setFrequency(frequency * float((&string - &strings[0]) + 1), 44100.0f);
-        }
-    }
-    
-    // Process through multiple resonant strings at harmonic intervals
-    float stringOut = 0.0f;
-    for (int i = 0; i < 4; i++)
-    {
-        float harmFreq = frequency * float(i + 1);
-        strings[i].setFrequency(harmFreq, 44100.0f);
-        strings[i].damping = 0.1f; // Very resonant
-        float harmString = strings[i].process(excitation / float(i + 1));
-        stringOut += harmString * std::exp(-float(i) * 0.3f); // Exponential decay
-    }
-    
-    // Layer 2: Additive harmonics with exponential decay
-    float additiveOut = 0.0f;
-    for (int h = 1; h <= 12; h++)
-    {
-        float harmPhase = phase * float(h);
-        float harmEnv = std::exp(-phase * 5.0f * h); // Faster decay for higher harmonics
-        additiveOut += std::sin(harmPhase * 2.0f * M_PI) * harmEnv / float(h * h);
-    }
-    
-    // Layer 3: Resonant filter bank (glass resonances)
-    float filterBank = 0.0f;
-    for (int i = 0; i < 3; i++)
-    {
-        float resonFreq = frequency * (2.0f + i * 1.5f);
-        filters[i].setStateVariable(resonFreq, 12.0f, 44100.0f); // Very high Q
-        filterBank += filters[i].processBandpass(stringOut + additiveOut) * 0.3f;
-    }
-    
-    float output = stringOut * 0.4f + additiveOut * 0.3f + filterBank * 0.3f;
+    // Struck glass plate, ringing at its own eigenfrequencies
+    float output = (*crystalMatrixModes)[currentVoice].process(frequency) * 4.0f;
     
     // Pitch-shifted delays for harmonic cascades
     // Write to buffer
+    float* crystalPitchBuffer = modeArena.acquire(ModeStateArena::CrystalPitchRegion);
     crystalPitchBuffer[crystalPitchIndex] = output;
     
     // Read with pitch shifts
@@ -562,15 +882,15 @@ float SynthEngine::generateCrystalMatrix(float phase, float frequency)
     reverb.roomSize = 0.7f;
     reverb.damping = 0.2f; // Bright reverb
     reverb.wetLevel = 0.4f;
-    float shimmer = reverb.process(output);
+    float shimmer = freshState(reverb, reverbGeneration).process(output);
     
     // Harmonic enhancer
-    float enhanced = output + analogSaturate(output * 3.0f) * 0.1f;
+    float enhanced = output + shape(SlotSaturate, ShapeAnalogSaturate, output * 3.0f) * 0.1f;
     
-    return softClip((enhanced * 0.6f + shimmer * 0.4f) * 0.6f); // Normalized
+    return (enhanced * 0.6f + shimmer * 0.4f) * 0.6f; // Normalized
 }
 
-float SynthEngine::generateSolarWind(float phase, float frequency)
+StereoFrame<float> SynthEngine::generateSolarWind(float phase, float frequency)
 {
     // Smooth, expansive pad without rhythmic grain triggering
     
@@ -604,25 +924,15 @@ float SynthEngine::generateSolarWind(float phase, float frequency)
     filters[0].setStateVariable(breathFreq, 1.5f, 44100.0f);
     output = filters[0].processLowpass(output);
     
-    // Spacious reverb
-    reverb.roomSize = 0.95f;
-    reverb.damping = 0.3f;
-    reverb.wetLevel = 0.6f;
-    float reverbOut = reverb.process(output);
-    
-    // Gentle chorus for width
-    chorus.rate = 0.15f;
-    chorus.depth = 0.25f;
-    chorus.mix = 0.3f;
-    float chorusOut = chorus.process(output);
-    
-    // Mix final output
-    output = output * 0.3f + reverbOut * 0.5f + chorusOut * 0.2f;
+    // The voice's own diffusion network spreads the pad out, in stereo
+    auto& diffusion = freshState((*solarDiffusion)[currentVoice], (*solarDiffusion)[currentVoice].stateGeneration);
+    const auto wash = diffusion.process(output, solarFrozen);
     
-    return softClip(output * 0.7f);
+    const auto mix = StereoFrame<float>(output * 0.4f) + wash * StereoFrame<float>(0.1f);
+    return mix * StereoFrame<float>(0.7f); // Normalized
 }
 
-float SynthEngine::generateVoidResonance(float phase, float frequency)
+StereoFrame<float> SynthEngine::generateVoidResonance(float phase, float frequency)
 {
     // Deep evolving bass with upper harmonic tendrils
     
@@ -663,8 +973,8 @@ float SynthEngine::generateVoidResonance(float phase, float frequency)
     
     // Layer 3: Resonant pulse wave
     float pulseWidth = 0.3f + lfos[2].process() * 0.2f;
-    float pulsePhase = std::fmod(phase, 1.0f);
-    float pulseWave = pulsePhase < pulseWidth ? 1.0f : -1.0f;
+    float pulsePhase = phase - std::floor(phase);
+    float pulseWave = polyBlepPulse(pulsePhase, frequency / 44100.0f, pulseWidth);
     
     // Resonant filter on pulse
     filters[2].setMoogLadder(frequency * 4.0f, 4.0f, 44100.0f);
@@ -676,65 +986,27 @@ float SynthEngine::generateVoidResonance(float phase, float frequency)
                    formantMorph * 0.15f + 
                    resonantPulse * 0.1f;
     
-    // Multiband compression
-    // Low band (sub)
-    filters[3].setStateVariable(120.0f, 0.7f, 44100.0f);
-    float lowBand = filters[3].processLowpass(output);
-    lowBand = softClip(lowBand * 2.0f) * 0.5f;
-    
-    // Mid band
-    float midBand = output - lowBand;
-    midBand = softClip(midBand * 1.5f) * 0.6f;
-    
-    output = lowBand + midBand;
-    
-    // Spectral tilt (emphasize lows)
-    float tilt = output - filters[3].processHighpass(output) * 0.3f;
+    // Multiband saturation and compression, tilted towards the lows
+    output = (*voidMultiband)[currentVoice].process(output);
     
     // Dimension expander for width
-    dimension.size = 0.3f;
-    dimension.diffusion = 0.5f;
-    auto [left, right] = dimension.process(tilt);
+    dimension->size = 0.3f;
+    dimension->diffusion = 0.5f;
+    auto [left, right] = dimension->process(output);
     
     // Deep space reverb (subtle)
     reverb.roomSize = 0.7f;
     reverb.damping = 0.8f; // Dark reverb
     reverb.wetLevel = 0.15f;
-    float spaceReverb = reverb.process((left + right) * 0.5f);
+    float spaceReverb = freshState(reverb, reverbGeneration).process((left + right) * 0.5f);
     
-    output = tilt * 0.8f + spaceReverb * 0.2f;
-    
-    // Final limiting
-    return softClip(output * 0.6f * velocity); // Normalized
+    const float gain = 0.6f * velocity; // Normalized
+    return { (left * 0.8f + spaceReverb * 0.2f) * gain,
+             (right * 0.8f + spaceReverb * 0.2f) * gain };
 }
 
 // Helper function implementations
 
-void SynthEngine::WavetableOscillator::initialize()
-{
-    // Create professional wavetables with smooth morphing
-    for (int table = 0; table < NUM_TABLES; table++)
-    {
-        for (int i = 0; i < TABLE_SIZE; i++)
-        {
-            float phase = static_cast<float>(i) / TABLE_SIZE;
-            tables[table][i] = 0.0f;
-            
-            // Progressive harmonic complexity
-            int numHarmonics = 1 + table;
-            for (int h = 1; h <= numHarmonics; h++)
-            {
-                // Natural harmonic rolloff
-                float amplitude = 1.0f / (h * (1.0f + table * 0.1f));
-                tables[table][i] += std::sin(2.0f * juce::MathConstants<float>::pi * phase * h) * amplitude;
-            }
-            
-            // Normalize with soft knee
-            tables[table][i] = std::tanh(tables[table][i] * 0.5f);
-        }
-    }
-}
-
 float SynthEngine::WavetableOscillator::generate(float phase)
 {
     int tableA = static_cast<int>(morphPosition);
@@ -746,93 +1018,581 @@ float SynthEngine::WavetableOscillator::generate(float phase)
     int nextIndex = (index + 1) % TABLE_SIZE;
     float frac = floatIndex - index;
     
-    float sampleA = tables[tableA][index] * (1.0f - frac) + tables[tableA][nextIndex] * frac;
-    float sampleB = tables[tableB][index] * (1.0f - frac) + tables[tableB][nextIndex] * frac;
+    const auto& tableSet = DSPTables::wavetables;
+    float sampleA = tableSet[tableA][index] * (1.0f - frac) + tableSet[tableA][nextIndex] * frac;
+    float sampleB = tableSet[tableB][index] * (1.0f - frac) + tableSet[tableB][nextIndex] * frac;
     
     return sampleA * (1.0f - blend) + sampleB * blend;
 }
 
-void SynthEngine::Filter::setStateVariable(float frequency, float resonance, float sampleRate)
+void SynthEngine::UnisonOscillator::configure(int subVoices, float detuneCents, float spread)
 {
-    f = 2.0f * std::sin(juce::MathConstants<float>::pi * 
-        std::min(frequency, sampleRate * 0.49f) / sampleRate);
-    q = 1.0f / std::max(resonance, 0.5f);
+    numSubVoices = subVoices;
+    
+    // Equal power across the stack and across the pan law
+    const float level = juce::MathConstants<float>::sqrt2 / std::sqrt(static_cast<float>(subVoices));
+    
+    for (int i = 0; i < MAX_SUB_VOICES; i++)
+    {
+        if (i >= subVoices)
+        {
+            ratio[i] = inverseRatio[i] = 1.0f;
+            gainLeft[i] = gainRight[i] = 0.0f;
+            continue;
+        }
+        
+        // Sub-voices sit evenly from -1 to 1 across the detune and pan range
+        const float position = subVoices > 1 ? 2.0f * i / (subVoices - 1) - 1.0f : 0.0f;
+        ratio[i] = std::exp2(position * 0.5f * detuneCents / 1200.0f);
+        inverseRatio[i] = 1.0f / ratio[i];
+        
+        const float angle = (position * spread + 1.0f) * juce::MathConstants<float>::pi * 0.25f;
+        gainLeft[i] = std::cos(angle) * level;
+        gainRight[i] = std::sin(angle) * level;
+    }
 }
 
-float SynthEngine::Filter::processLowpass(float input)
+void SynthEngine::UnisonOscillator::restart(float randomness, std::mt19937& random)
 {
-    low += f * band;
-    high = input - low - q * band;
-    band += f * high;
-    return low;
+    // A single voice always starts at zero so its attack is repeatable
+    std::uniform_real_distribution<float> distribution(0.0f, randomness);
+    for (int i = 0; i < MAX_SUB_VOICES; i++)
+    {
+        phase[i] = numSubVoices > 1 ? distribution(random) : 0.0f;
+    }
 }
 
-float SynthEngine::Filter::processBandpass(float input)
+StereoFrame<float> SynthEngine::UnisonOscillator::processSaw(float frequency)
 {
-    low += f * band;
-    high = input - low - q * band;
-    band += f * high;
-    return band;
+    const float increment = std::max(frequency, 1.0f) / 44100.0f;
+    if (numSubVoices <= LANE_BLOCK)
+        return processSawLanes<LANE_BLOCK>(increment);
+    return processSawLanes<MAX_SUB_VOICES>(increment);
 }
 
-float SynthEngine::Filter::processHighpass(float input)
+template <int Lanes>
+StereoFrame<float> SynthEngine::UnisonOscillator::processSawLanes(float increment)
 {
-    low += f * band;
-    high = input - low - q * band;
-    band += f * high;
-    return high;
+    using Register = juce::dsp::SIMDRegister<float>;
+    constexpr int width = static_cast<int>(Register::SIMDNumElements);
+    static_assert(Lanes % width == 0);
+    
+    const Register zero(0.0f);
+    const float inverseIncrement = 1.0f / increment;
+    Register left(0.0f);
+    Register right(0.0f);
+    
+    for (int i = 0; i < Lanes; i += width)
+    {
+        // Phases stay positive, so truncation wraps them into [0, 1)
+        auto p = Register::fromRawArray(phase.data() + i) + Register::fromRawArray(ratio.data() + i) * increment;
+        p -= Register::truncate(p);
+        p.copyToRawArray(phase.data() + i);
+        
+        // PolyBLEP around the wrap, in the branch-free form of polyBlep()
+        const auto inverseDt = Register::fromRawArray(inverseRatio.data() + i) * inverseIncrement;
+        const auto before = Register::max(zero, (p - 1.0f) * inverseDt + 1.0f);
+        const auto after = Register::max(zero, Register(1.0f) - p * inverseDt);
+        const auto saw = p * 2.0f - 1.0f - (before * before - after * after);
+        left += saw * Register::fromRawArray(gainLeft.data() + i);
+        right += saw * Register::fromRawArray(gainRight.data() + i);
+    }
+    
+    return { left.sum(), right.sum() };
 }
 
-float SynthEngine::Filter::processNotch(float input)
+void SynthEngine::CrossFMCore::restart()
 {
-    low += f * band;
-    high = input - low - q * band;
-    band += f * high;
-    return low + high;
+    phaseA = phaseB = 0.0f;
+    lastA = lastB = 0.0f;
+}
+
+void SynthEngine::CrossFMCore::reset()
+{
+    restart();
+    for (auto& branch : history)
+        branch.fill(0.0f);
+    historyIndex = 0;
+}
+
+float SynthEngine::CrossFMCore::process(int oversampling, float increment, float depth, float morph, float warp)
+{
+    // The branches hold a different phase split per factor
+    if (oversampling != factor)
+    {
+        factor = oversampling;
+        for (auto& branch : history)
+            branch.fill(0.0f);
+    }
+    
+    return factor == 4 ? processOversampled<4>(increment, depth, morph, warp)
+                       : processOversampled<2>(increment, depth, morph, warp);
+}
+
+template <int Factor>
+float SynthEngine::CrossFMCore::processOversampled(float increment, float depth, float morph, float warp)
+{
+    static_assert(Factor <= MAX_FACTOR);
+    const float step = increment / Factor;
+    const float warpCurve = warp * 0.25f;
+    
+    historyIndex = (historyIndex + BRANCH_TAPS - 1) % BRANCH_TAPS;
+    
+    for (int s = 0; s < Factor; s++)
+    {
+        phaseA += step;
+        phaseA -= static_cast<float>(static_cast<int>(phaseA));
+        phaseB += step * 1.01f; // Slight detune
+        phaseB -= static_cast<float>(static_cast<int>(phaseB));
+        
+        // Each operator is phase modulated by the other's previous output
+        const float a = tableSine(phaseA + depth * lastB);
+        const float b = tableSine(phaseB + depth * lastA);
+        lastA = a;
+        lastB = b;
+        
+        // Chebyshev polynomials of a sine are its exact harmonics: 1-5 here,
+        // odd weighted 1/n and even 1/2n as partials used to be
+        const float x = tableSine(phaseA);
+        const float x2 = x * x;
+        const float t2 = 2.0f * x2 - 1.0f;
+        const float t3 = x * (4.0f * x2 - 3.0f);
+        const float t4 = 2.0f * t2 * t2 - 1.0f;
+        const float t5 = x * (16.0f * x2 * x2 - 20.0f * x2 + 5.0f);
+        const float odd = x + t3 * (1.0f / 3.0f) + t5 * 0.2f;
+        const float even = t2 * 0.25f + t4 * 0.125f;
+        const float harmonics = odd + (even - odd) * morph;
+        
+        // Warp bends the peaks outwards, then the tube stage
+        float mixed = (a + b) * 0.3f + harmonics * 0.2f;
+        mixed *= 1.0f - warpCurve + warpCurve * std::abs(mixed);
+        
+        // The newest sample of each output period lands in branch 0
+        const int branch = Factor - 1 - s;
+        history[branch][historyIndex] = history[branch][historyIndex + BRANCH_TAPS] = saturate(mixed * 2.0f) * 0.7f;
+    }
+    
+    // Polyphase decimation: each branch filters its own phase of the input
+    const float* filter = Factor == 4 ? DSPTables::decimator4x.data() : DSPTables::decimator2x.data();
+    float output = 0.0f;
+    for (int p = 0; p < Factor; p++)
+    {
+        const float* h = filter + p * BRANCH_TAPS;
+        const float* in = history[p].data() + historyIndex;
+        for (int k = 0; k < BRANCH_TAPS; k++)
+            output += h[k] * in[k];
+    }
+    return output;
+}
+
+float SynthEngine::CrossFMCore::tableSine(float cycles)
+{
+    // Offset keeps the truncation a floor for the small negative phases FM produces
+    const float wrapped = cycles - static_cast<float>(static_cast<int>(cycles + 1024.0f) - 1024);
+    const float position = wrapped * DSPTables::SINE_TABLE_SIZE;
+    const int index = static_cast<int>(position);
+    const float fraction = position - static_cast<float>(index);
+    
+    const auto& table = DSPTables::sineTable;
+    const int i = index & (DSPTables::SINE_TABLE_SIZE - 1);
+    return table[i] + (table[i + 1] - table[i]) * fraction;
+}
+
+float SynthEngine::CrossFMCore::saturate(float input)
+{
+    // analogSaturate's curve, with a rational tanh that meets +-1 at the clamp
+    const float x = input * 0.7f;
+    const float shaped = x + x * x * 0.1f - x * x * x * 0.05f;
+    const float t = juce::jlimit(-3.0f, 3.0f, shaped * 1.5f);
+    return t * (27.0f + t * t) / (27.0f + 9.0f * t * t) * 0.7f;
+}
+
+void SynthEngine::BassVoice::restart()
+{
+    lastPhase = 0.0f;
+    subHalf = 0.0f;
+    rectifiedSum = 0.0f;
+    envelope = 0.0f;
+    ladderG = ladderCoefficient(450.0f);
+    ladderStep = 0.0f;
+    controlCounter = CONTROL_INTERVAL;
+}
+
+void SynthEngine::BassVoice::reset()
+{
+    restart();
+    for (auto& s : stage)
+        s = 0.0f;
+}
+
+float SynthEngine::BassVoice::oscillate(float phase)
+{
+    // Each wrap of the main phase moves the sub into the other half of its cycle
+    if (phase < lastPhase)
+        subHalf = 0.5f - subHalf;
+    lastPhase = phase;
+    
+    const float fundamental = CrossFMCore::tableSine(phase);
+    const float sub = CrossFMCore::tableSine(phase * 0.5f + subHalf);
+    const float second = CrossFMCore::tableSine(phase * 2.0f) * 0.3f;
+    
+    return fundamental * 0.6f + sub * 0.5f + second * 0.2f;
+}
+
+float SynthEngine::BassVoice::filter(float input, float resonance)
+{
+    if (--controlCounter <= 0)
+    {
+        controlCounter = CONTROL_INTERVAL;
+        
+        // Mean level of the last interval into a 5 ms attack / 120 ms release
+        // follower, coefficients taken at the control rate
+        const float level = rectifiedSum / float(CONTROL_INTERVAL);
+        rectifiedSum = 0.0f;
+        envelope += (level - envelope) * (level > envelope ? 0.135f : 0.006f);
+        
+        const float target = ladderCoefficient(450.0f + envelope * 1000.0f);
+        ladderStep = (target - ladderG) / float(CONTROL_INTERVAL);
+    }
+    
+    rectifiedSum += std::abs(input);
+    ladderG += ladderStep;
+    
+    const float k = juce::jlimit(0.0f, 3.6f, resonance);
+    const float output = ladderTick<DriveTanh>(input, ladderG, k, stage[0], stage[1], stage[2], stage[3]);
+    return output * (1.0f + 0.5f * k);
+}
+
+float SynthEngine::BassVoice::ladderCoefficient(float cutoff) const
+{
+    const float g = std::tan(juce::MathConstants<float>::pi * juce::jlimit(10.0f, sampleRate * 0.45f, cutoff) / sampleRate);
+    return g / (1.0f + g);
+}
+
+void SynthEngine::MinBlep::build(Table& table)
+{
+    // Twice the impulse length, so the cepstrum does not alias
+    constexpr int fftOrder = 12;
+    constexpr int fftSize = 1 << fftOrder;
+    static_assert(fftSize >= 2 * TABLE_SIZE);
+    
+    juce::dsp::FFT fft(fftOrder);
+    std::vector<float> buffer(2 * fftSize, 0.0f);
+    
+    // Blackman-windowed sinc over ZERO_CROSSINGS either side, oversampled
+    for (int i = 0; i < TABLE_SIZE; i++)
+    {
+        const double x = juce::MathConstants<double>::pi * (i - TABLE_SIZE / 2) / OVERSAMPLING;
+        const double sinc = i == TABLE_SIZE / 2 ? 1.0 : std::sin(x) / x;
+        const double w = juce::MathConstants<double>::twoPi * i / TABLE_SIZE;
+        buffer[i] = static_cast<float>(sinc * (0.42 - 0.5 * std::cos(w) + 0.08 * std::cos(2.0 * w)));
+    }
+    
+    // Real cepstrum
+    fft.performRealOnlyForwardTransform(buffer.data());
+    for (int k = 0; k <= fftSize / 2; k++)
+    {
+        const float magnitude = std::hypot(buffer[2 * k], buffer[2 * k + 1]);
+        buffer[2 * k] = std::log(std::max(magnitude, 1.0e-9f));
+        buffer[2 * k + 1] = 0.0f;
+    }
+    fft.performRealOnlyInverseTransform(buffer.data());
+    
+    // Fold onto positive quefrencies: the log spectrum of the minimum-phase
+    // filter with the same magnitude
+    for (int i = 1; i < fftSize / 2; i++)
+        buffer[i] *= 2.0f;
+    std::fill(buffer.begin() + fftSize / 2 + 1, buffer.end(), 0.0f);
+    
+    fft.performRealOnlyForwardTransform(buffer.data());
+    for (int k = 0; k <= fftSize / 2; k++)
+    {
+        const float magnitude = std::exp(buffer[2 * k]);
+        const float angle = buffer[2 * k + 1];
+        buffer[2 * k] = magnitude * std::cos(angle);
+        buffer[2 * k + 1] = magnitude * std::sin(angle);
+    }
+    fft.performRealOnlyInverseTransform(buffer.data());
+    
+    // Integrate the minimum-phase impulse into a step normalised to 1 and
+    // keep what is left once the ideal step is subtracted
+    double total = 0.0;
+    for (int i = 0; i < TABLE_SIZE; i++)
+        total += buffer[i];
+    
+    double step = 0.0;
+    for (int i = 0; i < TABLE_SIZE; i++)
+    {
+        step += buffer[i];
+        table[i] = static_cast<float>(step / total - 1.0);
+    }
+    table[TABLE_SIZE] = 0.0f;
+}
+
+void SynthEngine::SyncOscillator::initialize(const MinBlep::Table& sharedResidual)
+{
+    residual = &sharedResidual;
+    reset();
+}
+
+void SynthEngine::SyncOscillator::reset()
+{
+    masterPhase = slavePhase = 0.0f;
+    correction.fill(0.0f);
+    readIndex = 0;
+}
+
+void SynthEngine::SyncOscillator::addStep(float samplesAgo, float height)
+{
+    // The naive output already jumped; the residual smooths it out over
+    // the next LENGTH samples, starting with the current one
+    for (int i = 0; i < MinBlep::LENGTH; i++)
+    {
+        const float position = (static_cast<float>(i) + samplesAgo) * MinBlep::OVERSAMPLING;
+        const int index = std::min(static_cast<int>(position), MinBlep::TABLE_SIZE - 1);
+        const float frac = position - static_cast<float>(index);
+        const float value = (*residual)[index] + ((*residual)[index + 1] - (*residual)[index]) * frac;
+        correction[(readIndex + i) % MinBlep::LENGTH] += height * value;
+    }
+}
+
+float SynthEngine::SyncOscillator::process(float masterIncrement, float slaveIncrement)
+{
+    masterPhase += masterIncrement;
+    slavePhase += slaveIncrement;
+    
+    if (masterPhase >= 1.0f)
+    {
+        // Restart the slave where the master wrapped, between samples
+        masterPhase -= 1.0f;
+        const float samplesAgo = masterPhase / masterIncrement;
+        
+        float phaseAtSync = slavePhase - samplesAgo * slaveIncrement;
+        phaseAtSync -= std::floor(phaseAtSync);
+        
+        slavePhase = samplesAgo * slaveIncrement;
+        addStep(samplesAgo, -2.0f * phaseAtSync);
+    }
+    else if (slavePhase >= 1.0f)
+    {
+        slavePhase -= 1.0f;
+        addStep(slavePhase / slaveIncrement, -2.0f);
+    }
+    
+    const float output = 2.0f * slavePhase - 1.0f + correction[readIndex];
+    correction[readIndex] = 0.0f;
+    readIndex = (readIndex + 1) % MinBlep::LENGTH;
+    return output;
+}
+
+void SynthEngine::Filter::setStateVariable(float frequency, float resonance, float sampleRate)
+{
+    f = 2.0f * std::sin(juce::MathConstants<float>::pi * 
+        std::min(frequency, sampleRate * 0.49f) / sampleRate);
+    q = 1.0f / std::max(resonance, 0.5f);
+}
+
+float SynthEngine::Filter::processLowpass(float input)
+{
+    low += f * band;
+    high = input - low - q * band;
+    band += f * high;
+    return low;
+}
+
+float SynthEngine::Filter::processBandpass(float input)
+{
+    low += f * band;
+    high = input - low - q * band;
+    band += f * high;
+    return band;
+}
+
+float SynthEngine::Filter::processHighpass(float input)
+{
+    low += f * band;
+    high = input - low - q * band;
+    band += f * high;
+    return high;
+}
+
+float SynthEngine::Filter::processNotch(float input)
+{
+    low += f * band;
+    high = input - low - q * band;
+    band += f * high;
+    return low + high;
 }
 
 void SynthEngine::Filter::setMoogLadder(float frequency, float resonance, float sampleRate)
 {
-    float fc = frequency / sampleRate;
-    float f = fc * 0.5f;
-    float fc2 = fc * fc;
-    float fc3 = fc2 * fc;
+    // Coefficients only move at control rate, or sooner on a large cutoff jump
+    bool bigJump = std::abs(frequency - ladderCutoff) > ladderCutoff * 0.05f;
+    if (--ladderCountdown > 0 && !bigJump && resonance == ladderResonance)
+        return;
     
-    float fcr = 1.8730f * fc3 + 0.4955f * fc2 - 0.6490f * fc + 0.9988f;
-    float acr = -3.9364f * fc2 + 1.8409f * fc + 0.9968f;
+    ladderCountdown = 16;
+    ladderCutoff = frequency;
+    ladderResonance = resonance;
     
-    feedback = resonance * (1.0f - 0.15f * fc2);
+    float fc = juce::jlimit(10.0f, sampleRate * 0.45f, frequency);
+    float g = std::tan(juce::MathConstants<float>::pi * fc / sampleRate);
+    ladderG = g / (1.0f + g);
     
-    // Calculate coefficients
-    float k = std::tan(juce::MathConstants<float>::pi * f);
-    float k2 = k * k;
-    float bh = 1.0f + k / resonance + k2;
+    // Modes pass resonance on a 0-4 scale; stay just below self-oscillation
+    feedback = juce::jlimit(0.0f, 3.6f, resonance);
 }
 
 float SynthEngine::Filter::processMoogLadder(float input)
 {
-    // 4-stage ladder filter
-    float sigma = feedback * stage[3];
+    float output = ladderTick<DriveTanh>(input, ladderG, feedback,
+                                         stage[0], stage[1], stage[2], stage[3]);
     
-    // Saturate feedback
-    sigma = std::tanh(sigma);
+    // Compensate the passband loss that comes with feedback
+    return output * (1.0f + 0.5f * feedback);
+}
+
+template <int Mode>
+float SynthEngine::driveShape(float x)
+{
+    // Branch-free (clamps written with abs) so the voice lanes vectorize
+    if constexpr (Mode == DriveTanh)
+    {
+        // Rational tanh, exact at the clip points
+        x = 0.5f * (std::abs(x + 3.0f) - std::abs(x - 3.0f));
+        return x * (27.0f + x * x) / (27.0f + 9.0f * x * x);
+    }
+    else if constexpr (Mode == DriveAsymmetric)
+    {
+        // Diode-style: the negative half is driven 1.5x harder, adding even harmonics
+        x = 1.25f * x - 0.25f * std::abs(x);
+        x = 0.5f * (std::abs(x + 3.0f) - std::abs(x - 3.0f));
+        float y = x * (27.0f + x * x) / (27.0f + 9.0f * x * x);
+        return (5.0f / 6.0f) * y + (1.0f / 6.0f) * std::abs(y);
+    }
+    else
+    {
+        return 0.5f * (std::abs(x + 1.0f) - std::abs(x - 1.0f));
+    }
+}
+
+template <int Mode>
+float SynthEngine::ladderTick(float input, float G, float k, float& s1, float& s2, float& s3, float& s4)
+{
+    // Solve the feedback loop linearly (Zavalishin), then saturate the
+    // summing node with the predicted output
+    float b = 1.0f - G; // 1 / (1 + g)
+    float G2 = G * G;
+    float S = G2 * G * b * s1 + G2 * b * s2 + G * b * s3 + b * s4;
+    float G4 = G2 * G2;
+    float y4 = (G4 * input + S) / (1.0f + k * G4);
     
-    input = std::tanh(input - sigma);
+    float u = driveShape<Mode>(input - k * y4);
     
-    // Process stages
-    stage[0] = input - delay[0];
-    delay[0] = input;
+    float v = (u - s1) * G;
+    float y1 = v + s1;
+    s1 = y1 + v;
     
-    stage[1] = stage[0] - delay[1];
-    delay[1] = stage[0];
+    v = (y1 - s2) * G;
+    float y2 = v + s2;
+    s2 = y2 + v;
     
-    stage[2] = stage[1] - delay[2];
-    delay[2] = stage[1];
+    v = (y2 - s3) * G;
+    float y3 = v + s3;
+    s3 = y3 + v;
     
-    stage[3] = stage[2] - delay[3];
-    delay[3] = stage[2];
+    v = (y3 - s4) * G;
+    y4 = v + s4;
+    s4 = y4 + v;
     
-    return stage[3];
+    return y4;
+}
+
+void SynthEngine::LadderFilterBank::setCoefficients(int lane, float cutoff, float resonance,
+                                                    float drive, float sampleRate)
+{
+    float fc = juce::jlimit(10.0f, sampleRate * 0.45f, cutoff);
+    float gw = std::tan(juce::MathConstants<float>::pi * fc / sampleRate);
+    g[lane] = gw / (1.0f + gw);
+    
+    // Map the Q-style resonance parameter (0.1 - 10) onto ladder feedback
+    k[lane] = 4.0f * (1.0f - 1.0f / (1.0f + 0.35f * std::max(0.0f, resonance - 0.1f)));
+    
+    inputGain[lane] = 1.0f + 3.0f * drive;
+    outputGain[lane] = (1.0f + 0.5f * k[lane]) / std::sqrt(inputGain[lane]);
+}
+
+void SynthEngine::LadderFilterBank::resetLane(int lane)
+{
+    s1[lane] = s2[lane] = s3[lane] = s4[lane] = 0.0f;
+}
+
+float SynthEngine::LadderFilterBank::processLane(int lane, float input)
+{
+    float x = input * inputGain[lane];
+    float y = 0.0f;
+    switch (driveMode)
+    {
+        case DriveAsymmetric:
+            y = ladderTick<DriveAsymmetric>(x, g[lane], k[lane], s1[lane], s2[lane], s3[lane], s4[lane]);
+            break;
+        case DriveHardClip:
+            y = ladderTick<DriveHardClip>(x, g[lane], k[lane], s1[lane], s2[lane], s3[lane], s4[lane]);
+            break;
+        default:
+            y = ladderTick<DriveTanh>(x, g[lane], k[lane], s1[lane], s2[lane], s3[lane], s4[lane]);
+            break;
+    }
+    return y * outputGain[lane];
+}
+
+template <int Mode>
+void SynthEngine::LadderFilterBank::processLanes(float* samples)
+{
+    for (int lane = 0; lane < LANES; lane++)
+    {
+        float x = samples[lane] * inputGain[lane];
+        float y = ladderTick<Mode>(x, g[lane], k[lane], s1[lane], s2[lane], s3[lane], s4[lane]);
+        samples[lane] = y * outputGain[lane];
+    }
+}
+
+void SynthEngine::LadderFilterBank::process(float* samples)
+{
+    switch (driveMode)
+    {
+        case DriveAsymmetric: processLanes<DriveAsymmetric>(samples); break;
+        case DriveHardClip:   processLanes<DriveHardClip>(samples); break;
+        default:              processLanes<DriveTanh>(samples); break;
+    }
+}
+
+void SynthEngine::setSampleRate(double newSampleRate)
+{
+    sampleRate = static_cast<float>(newSampleRate);
+    for (auto& voice : bassVoices)
+        voice.sampleRate = sampleRate;
+}
+
+void SynthEngine::setVoiceFilter(int voiceIndex, float cutoff, float resonance, float drive)
+{
+    if (voiceIndex < 0 || voiceIndex >= MAX_VOICES) return;
+    voiceLadders.setCoefficients(voiceIndex * 2, cutoff, resonance, drive, sampleRate);
+    voiceLadders.setCoefficients(voiceIndex * 2 + 1, cutoff, resonance, drive, sampleRate);
+}
+
+StereoFrame<float> SynthEngine::processVoiceFilter(int voiceIndex, StereoFrame<float> input)
+{
+    if (voiceIndex < 0 || voiceIndex >= MAX_VOICES) return input;
+    return { voiceLadders.processLane(voiceIndex * 2, input.left),
+             voiceLadders.processLane(voiceIndex * 2 + 1, input.right) };
+}
+
+void SynthEngine::processVoiceFilters(StereoFrame<float>* voiceFrames)
+{
+    // Frames are two packed floats, so the array is the interleaved lane layout
+    static_assert(sizeof(StereoFrame<float>) == 2 * sizeof(float));
+    voiceLadders.process(reinterpret_cast<float*>(voiceFrames));
 }
 
 float SynthEngine::Envelope::process(bool gate)
@@ -906,13 +1666,14 @@ float SynthEngine::Chorus::process(float input)
     return input * (1.0f - mix) + delayed * mix;
 }
 
-void SynthEngine::Reverb::initialize()
+template <typename SampleType>
+void SynthEngine::Reverb<SampleType>::initialize()
 {
     // Initialize comb filters with prime number delays
     int combDelays[] = {1557, 1617, 1491, 1422, 1277, 1356, 1188, 1116};
     for (int i = 0; i < NUM_COMBS; i++)
     {
-        combs[i].buffer.resize(combDelays[i], 0.0f);
+        combs[i].buffer.resize(combDelays[i], SampleType(0));
         combs[i].feedback = 0.84f;
         combs[i].damp = 0.2f;
     }
@@ -921,132 +1682,902 @@ void SynthEngine::Reverb::initialize()
     int allpassDelays[] = {556, 441, 341, 225};
     for (int i = 0; i < NUM_ALLPASS; i++)
     {
-        allpasses[i].buffer.resize(allpassDelays[i], 0.0f);
-        allpasses[i].feedback = 0.5f;
+        allpasses[i].buffer.resize(allpassDelays[i], SampleType(0));
+        allpasses[i].feedback = 0.5f;
+    }
+}
+
+template <typename SampleType>
+void SynthEngine::Reverb<SampleType>::clear()
+{
+    for (auto& comb : combs)
+    {
+        std::fill(comb.buffer.begin(), comb.buffer.end(), SampleType(0));
+        comb.index = 0;
+        comb.lastOut = 0;
+    }
+    
+    for (auto& allpass : allpasses)
+    {
+        std::fill(allpass.buffer.begin(), allpass.buffer.end(), SampleType(0));
+        allpass.index = 0;
+    }
+}
+
+template <typename SampleType>
+SampleType SynthEngine::Reverb<SampleType>::processSample(SampleType input)
+{
+    SampleType output = 0;
+    const SampleType damp = damping;
+    const SampleType room = roomSize;
+    
+    // Process comb filters in parallel
+    for (auto& comb : combs)
+    {
+        SampleType y = comb.buffer[comb.index];
+        comb.lastOut = y * (SampleType(1) - damp) + comb.lastOut * damp;
+        comb.buffer[comb.index] = input + comb.lastOut * SampleType(comb.feedback) * room;
+        comb.index = (comb.index + 1) % comb.buffer.size();
+        output += y;
+    }
+    
+    output *= SampleType(0.125); // Scale down
+    
+    // Process allpass filters in series
+    for (auto& allpass : allpasses)
+    {
+        const SampleType g = allpassPolarity * SampleType(allpass.feedback);
+        SampleType bufOut = allpass.buffer[allpass.index];
+        SampleType inSum = output + bufOut * g;
+        allpass.buffer[allpass.index] = inSum;
+        allpass.index = (allpass.index + 1) % allpass.buffer.size();
+        output = bufOut - inSum * g;
+    }
+    
+    return output * SampleType(wetLevel);
+}
+
+template <typename SampleType>
+void SynthEngine::DelayLine<SampleType>::resize(int size)
+{
+    buffer.resize(size, SampleType(0));
+    writeIndex = 0;
+}
+
+template <typename SampleType>
+void SynthEngine::DelayLine<SampleType>::clear()
+{
+    std::fill(buffer.begin(), buffer.end(), SampleType(0));
+    writeIndex = 0;
+}
+
+template <typename SampleType>
+SampleType SynthEngine::DelayLine<SampleType>::processSample(SampleType input)
+{
+    if (buffer.empty()) return input;
+    
+    // Write input
+    buffer[writeIndex] = input;
+    
+    // Calculate read position
+    int delaySamples = static_cast<int>(time * 44100.0f);
+    int readIndex = writeIndex - delaySamples;
+    if (readIndex < 0) readIndex += buffer.size();
+    
+    // Read delayed signal
+    SampleType delayed = buffer[readIndex];
+    
+    // Apply feedback
+    buffer[writeIndex] += delayed * SampleType(feedback);
+    
+    // Update write position
+    writeIndex = (writeIndex + 1) % buffer.size();
+    
+    // Mix dry and wet
+    const SampleType wet = mix;
+    return input * (SampleType(1) - wet) + delayed * wet;
+}
+
+template struct SynthEngine::Reverb<double>;
+template struct SynthEngine::DelayLine<double>;
+template struct SynthEngine::Reverb<StereoFrame<double>>;
+template struct SynthEngine::DelayLine<StereoFrame<double>>;
+
+void SynthEngine::FMVoice::setAlgorithm(const FMAlgorithm& algorithm,
+                                       const std::array<FMOperator, NUM_OPERATORS>& ops)
+{
+    for (auto& row : modMatrix)
+        row.fill(0.0f);
+    carrierGain.fill(0.0f);
+    
+    int numCarriers = 0;
+    for (int target = 0; target < NUM_OPERATORS; target++)
+    {
+        for (int source = 0; source < NUM_OPERATORS; source++)
+        {
+            if (algorithm.modulators[target] & (1 << source))
+                modMatrix[source][target] = 1.0f;
+        }
+        
+        if (algorithm.carriers & (1 << target))
+        {
+            carrierGain[target] = 1.0f;
+            numCarriers++;
+        }
+    }
+    
+    int fb = algorithm.feedbackOperator;
+    modMatrix[fb][fb] = ops[fb].feedback;
+    
+    // Keep summed carriers at roughly unity
+    for (auto& gain : carrierGain)
+        gain /= float(std::max(1, numCarriers));
+}
+
+void SynthEngine::FMVoice::noteOn(const std::array<FMOperator, NUM_OPERATORS>& ops, float velocity)
+{
+    for (int i = 0; i < NUM_OPERATORS; i++)
+    {
+        const auto& op = ops[i];
+        ratio[i] = op.ratio;
+        
+        // Velocity brightens modulators more than it raises carriers
+        bool isCarrier = carrierGain[i] > 0.0f;
+        level[i] = op.amplitude * (isCarrier ? 0.6f + 0.4f * velocity : 0.3f + 0.7f * velocity);
+        
+        envStage[i] = Attack;
+        envTarget[i] = 1.0f;
+        envCoeff[i] = 1.0f - std::exp(-1.0f / (std::max(op.attack, 0.0005f) * 44100.0f));
+        decayCoeff[i] = 1.0f - std::exp(-1.0f / (std::max(op.decay, 0.001f) * 44100.0f));
+        releaseCoeff[i] = 1.0f - std::exp(-1.0f / (std::max(op.release, 0.001f) * 44100.0f));
+        sustainLevel[i] = op.sustain;
+    }
+    
+    controlCounter = 0;
+}
+
+void SynthEngine::FMVoice::noteOff()
+{
+    for (int i = 0; i < NUM_OPERATORS; i++)
+    {
+        if (envStage[i] == Idle) continue;
+        envStage[i] = Release;
+        envTarget[i] = 0.0f;
+        envCoeff[i] = releaseCoeff[i];
+    }
+}
+
+void SynthEngine::FMVoice::reset()
+{
+    phase.fill(0.0f);
+    output.fill(0.0f);
+    envLevel.fill(0.0f);
+    envTarget.fill(0.0f);
+    envCoeff.fill(0.0f);
+    envStage.fill(Idle);
+    controlCounter = 0;
+}
+
+void SynthEngine::FMVoice::updateControl(float newFrequency)
+{
+    frequency = newFrequency;
+    for (int i = 0; i < NUM_OPERATORS; i++)
+    {
+        increment[i] = frequency * ratio[i] / 44100.0f;
+        
+        // Envelope segment transitions happen at control rate only
+        if (envStage[i] == Attack && envLevel[i] >= 0.99f)
+        {
+            envStage[i] = Decay;
+            envTarget[i] = sustainLevel[i];
+            envCoeff[i] = decayCoeff[i];
+        }
+        else if (envStage[i] == Release && envLevel[i] < 0.0001f)
+        {
+            envStage[i] = Idle;
+            envLevel[i] = 0.0f;
+            envCoeff[i] = 0.0f;
+        }
+    }
+}
+
+float SynthEngine::FMVoice::process(float newFrequency)
+{
+    if (--controlCounter <= 0 || std::abs(newFrequency - frequency) > 0.01f)
+    {
+        updateControl(newFrequency);
+        controlCounter = CONTROL_INTERVAL;
+    }
+    
+    // Matrix routing on last sample's outputs, one lane per operator
+    alignas(32) std::array<float, NUM_LANES> modulation {};
+    for (int source = 0; source < NUM_LANES; source++)
+    {
+        for (int target = 0; target < NUM_LANES; target++)
+        {
+            modulation[target] += modMatrix[source][target] * output[source];
+        }
+    }
+    
+    for (int i = 0; i < NUM_LANES; i++)
+    {
+        envLevel[i] += (envTarget[i] - envLevel[i]) * envCoeff[i];
+        output[i] = fastSin(phase[i] + modulation[i]) * level[i] * envLevel[i];
+        phase[i] += increment[i];
+        phase[i] -= phase[i] >= 1.0f ? 1.0f : 0.0f;
+    }
+    
+    float sum = 0.0f;
+    for (int i = 0; i < NUM_LANES; i++)
+    {
+        sum += output[i] * carrierGain[i];
+    }
+    return sum;
+}
+
+void SynthEngine::AdditiveOscillator::buildKernel(Kernel& kernel)
+{
+    // Spectrum of the zero-phase Hann window, sampled finely so a partial at
+    // any fractional bin can be splatted into a frame
+    for (size_t m = 0; m < kernel.size(); m++)
+    {
+        double delta = double(m) / KERNEL_OVERSAMPLE;
+        double sum = 0.0;
+        for (int n = 1; n < FFT_SIZE / 2; n++)
+        {
+            double w = 0.5 + 0.5 * std::cos(2.0 * juce::MathConstants<double>::pi * n / FFT_SIZE);
+            sum += w * std::cos(2.0 * juce::MathConstants<double>::pi * delta * n / FFT_SIZE);
+        }
+        kernel[m] = static_cast<float>(1.0 + 2.0 * sum);
+    }
+}
+
+void SynthEngine::AdditiveOscillator::initialize(const Kernel& sharedKernel, const juce::dsp::FFT& sharedFFT)
+{
+    kernel = &sharedKernel;
+    fft = &sharedFFT;
+    
+    for (int p = 0; p < MAX_PARTIALS; p++)
+    {
+        ratio[p] = float(p + 1);
+    }
+    
+    reset();
+}
+
+void SynthEngine::AdditiveOscillator::reset()
+{
+    targetAmplitude.fill(0);
+    amplitude.fill(0);
+    amplitudeStep.fill(0);
+    oscSin.fill(0);
+    oscCos.fill(1.0f);
+    framePhase.fill(0);
+    olaBuffer.fill(0);
+    frequency = 0.0f;
+    rotationDirty = true;
+    controlCounter = 0;
+    readIndex = 0;
+    hopCounter = 0;
+}
+
+void SynthEngine::AdditiveOscillator::setPartials(const float* amplitudes, int count)
+{
+    int newCount = std::clamp(count, 0, MAX_PARTIALS);
+    for (int p = 0; p < newCount; p++)
+    {
+        targetAmplitude[p] = amplitudes[p];
+    }
+    for (int p = newCount; p < numPartials; p++)
+    {
+        targetAmplitude[p] = 0.0f;
+        amplitude[p] = 0.0f;
+    }
+    
+    if (newCount != numPartials)
+    {
+        numPartials = newCount;
+        rotationDirty = true;
+    }
+    
+    bool wantInverseFFT = numPartials >= IFFT_THRESHOLD;
+    if (wantInverseFFT != useInverseFFT)
+    {
+        switchRenderer(wantInverseFFT);
+    }
+}
+
+void SynthEngine::AdditiveOscillator::updateControl(float newFrequency)
+{
+    if (rotationDirty || std::abs(newFrequency - frequency) > 0.01f)
+    {
+        frequency = newFrequency;
+        rotationDirty = false;
+        for (int p = 0; p < numPartials; p++)
+        {
+            float w = 2.0f * juce::MathConstants<float>::pi * frequency * ratio[p] / 44100.0f;
+            rotSin[p] = std::sin(w);
+            rotCos[p] = std::cos(w);
+        }
+    }
+    
+    const float nyquistLimit = 44100.0f * 0.45f;
+    for (int p = 0; p < numPartials; p++)
+    {
+        float target = frequency * ratio[p] < nyquistLimit ? targetAmplitude[p] : 0.0f;
+        amplitudeStep[p] = (target - amplitude[p]) / CONTROL_INTERVAL;
+        
+        // Keep the recursive oscillators on the unit circle
+        float gain = 1.5f - 0.5f * (oscSin[p] * oscSin[p] + oscCos[p] * oscCos[p]);
+        oscSin[p] *= gain;
+        oscCos[p] *= gain;
+    }
+    
+    controlCounter = CONTROL_INTERVAL;
+}
+
+float SynthEngine::AdditiveOscillator::process(float newFrequency)
+{
+    if (controlCounter <= 0)
+    {
+        updateControl(newFrequency);
+    }
+    controlCounter--;
+    
+    return useInverseFFT ? processInverseFFT() : processOscillatorBank();
+}
+
+float SynthEngine::AdditiveOscillator::processOscillatorBank()
+{
+    constexpr int LANES = 8;
+    alignas(32) std::array<float, LANES> lanes {};
+    
+    // Partials past numPartials have zero amplitude, so rounding up is harmless
+    const int count = std::min(MAX_PARTIALS, (numPartials + LANES - 1) / LANES * LANES);
+    for (int base = 0; base < count; base += LANES)
+    {
+        for (int l = 0; l < LANES; l++)
+        {
+            const int p = base + l;
+            lanes[l] += oscSin[p] * amplitude[p];
+            amplitude[p] += amplitudeStep[p];
+            
+            float s = oscSin[p] * rotCos[p] + oscCos[p] * rotSin[p];
+            float c = oscCos[p] * rotCos[p] - oscSin[p] * rotSin[p];
+            oscSin[p] = s;
+            oscCos[p] = c;
+        }
+    }
+    
+    float sum = 0.0f;
+    for (float lane : lanes)
+        sum += lane;
+    return sum;
+}
+
+float SynthEngine::AdditiveOscillator::processInverseFFT()
+{
+    if (hopCounter <= 0)
+    {
+        synthesizeFrame(0);
+        hopCounter = HOP_SIZE;
+    }
+    hopCounter--;
+    
+    float output = olaBuffer[readIndex];
+    olaBuffer[readIndex] = 0.0f;
+    readIndex = (readIndex + 1) & (FFT_SIZE - 1);
+    return output;
+}
+
+float SynthEngine::AdditiveOscillator::kernelAt(float binOffset) const
+{
+    float position = std::abs(binOffset) * KERNEL_OVERSAMPLE;
+    int index = static_cast<int>(position);
+    if (index >= KERNEL_BINS * KERNEL_OVERSAMPLE) return 0.0f;
+    
+    float frac = position - index;
+    const auto& table = *kernel;
+    return table[index] + (table[index + 1] - table[index]) * frac;
+}
+
+void SynthEngine::AdditiveOscillator::synthesizeFrame(int startOffset)
+{
+    // Frame spectrum: each partial is the window's main lobe centred on its
+    // fractional bin, plus its negative-frequency image near DC
+    std::fill(frame.begin(), frame.end(), 0.0f);
+    
+    const float binsPerHz = float(FFT_SIZE) / 44100.0f;
+    const float maxBin = float(FFT_SIZE / 2 - KERNEL_BINS);
+    
+    for (int p = 0; p < numPartials; p++)
+    {
+        float partialFreq = frequency * ratio[p];
+        float bin = partialFreq * binsPerHz;
+        amplitude[p] = (bin > 0.0f && bin < maxBin) ? targetAmplitude[p] : 0.0f;
+        
+        float phaseCycles = framePhase[p];
+        framePhase[p] += partialFreq * HOP_SIZE / 44100.0f;
+        framePhase[p] -= std::floor(framePhase[p]);
+        
+        if (amplitude[p] == 0.0f) continue;
+        
+        // Sine phase convention, matching the oscillator bank
+        float re = 0.5f * amplitude[p] * std::sin(2.0f * juce::MathConstants<float>::pi * phaseCycles);
+        float im = -0.5f * amplitude[p] * std::cos(2.0f * juce::MathConstants<float>::pi * phaseCycles);
+        
+        int first = std::max(0, static_cast<int>(std::ceil(bin - KERNEL_BINS)));
+        int last = static_cast<int>(bin + KERNEL_BINS);
+        for (int k = first; k <= last; k++)
+        {
+            float w = kernelAt(k - bin);
+            frame[2 * k] += w * re;
+            frame[2 * k + 1] += w * im;
+        }
+        
+        for (int k = 0; k < KERNEL_BINS - bin; k++)
+        {
+            float w = kernelAt(k + bin);
+            frame[2 * k] += w * re;
+            frame[2 * k + 1] -= w * im;
+        }
+    }
+    
+    fft->performRealOnlyInverseTransform(frame.data());
+    
+    // The frame is zero-phase (centre at index 0); rotate it back into time
+    // order as it is overlap-added
+    for (int i = std::max(0, -startOffset); i < FFT_SIZE; i++)
+    {
+        olaBuffer[(readIndex + startOffset + i) & (FFT_SIZE - 1)] += frame[(i + FFT_SIZE / 2) & (FFT_SIZE - 1)];
+    }
+}
+
+void SynthEngine::AdditiveOscillator::switchRenderer(bool inverseFFT)
+{
+    constexpr float twoPi = 2.0f * juce::MathConstants<float>::pi;
+    olaBuffer.fill(0);
+    useInverseFFT = inverseFFT;
+    
+    if (inverseFFT)
+    {
+        // Carry the bank's phases over, and prime the buffer with a frame
+        // centred on now so the first hop does not fade in from silence
+        for (int p = 0; p < numPartials; p++)
+        {
+            framePhase[p] = std::atan2(oscSin[p], oscCos[p]) / twoPi;
+        }
+        synthesizeFrame(-HOP_SIZE);
+        hopCounter = 0;
+    }
+    else
+    {
+        // The next frame would have been centred one hop ahead
+        for (int p = 0; p < numPartials; p++)
+        {
+            float phaseNow = twoPi * (framePhase[p] - frequency * ratio[p] * HOP_SIZE / 44100.0f);
+            oscSin[p] = std::sin(phaseNow);
+            oscCos[p] = std::cos(phaseNow);
+            amplitude[p] = targetAmplitude[p];
+        }
+    }
+}
+
+void SynthEngine::ModalBank::setModes(const float* modeRatios, const float* modeAmplitudes, int count,
+                                      float decaySeconds, float damping)
+{
+    jassert(count > 0 && count <= MAX_MODES);
+    numModes = juce::jlimit(1, MAX_MODES, count);
+    numLanes = (numModes + LANE_BLOCK - 1) / LANE_BLOCK * LANE_BLOCK;
+    
+    // Scaled so a full-velocity strike cannot sum past unity
+    float total = 0.0f;
+    for (int i = 0; i < numModes; i++)
+        total += std::abs(modeAmplitudes[i]);
+    
+    for (int i = 0; i < MAX_MODES; i++)
+    {
+        if (i >= numModes)
+        {
+            ratio[i] = amplitude[i] = radius[i] = 0.0f;
+            continue;
+        }
+        
+        // The pole radius reaches -60 dB after the mode's decay time
+        const float decay = decaySeconds / (1.0f + damping * (modeRatios[i] - 1.0f));
+        ratio[i] = modeRatios[i];
+        amplitude[i] = total > 0.0f ? modeAmplitudes[i] / total : 0.0f;
+        radius[i] = std::exp(-6.9077553f / (decay * 44100.0f));
+    }
+    
+    tunedFrequency = 0.0f;
+    reset();
+}
+
+void SynthEngine::ModalBank::strike(float level)
+{
+    // The Hann pulse sums to half its length
+    strikeLevel = level * (2.0f / DSPTables::MALLET_LENGTH);
+    strikePosition = 0;
+    controlCounter = 0;
+}
+
+void SynthEngine::ModalBank::reset()
+{
+    y1.fill(0.0f);
+    y2.fill(0.0f);
+    strikePosition = DSPTables::MALLET_LENGTH;
+    controlCounter = 0;
+}
+
+void SynthEngine::ModalBank::tune(float frequency)
+{
+    tunedFrequency = frequency;
+    const float highest = 0.45f * 44100.0f;
+    
+    for (int i = 0; i < numLanes; i++)
+    {
+        const float modeFrequency = frequency * ratio[i];
+        if (i >= numModes || modeFrequency >= highest)
+        {
+            b1[i] = b2[i] = inputGain[i] = 0.0f;
+            continue;
+        }
+        
+        // Input gain of sin(w) gives each mode an impulse response of
+        // amplitude * r^n * sin(w (n + 1))
+        const float w = juce::MathConstants<float>::twoPi * modeFrequency / 44100.0f;
+        b1[i] = 2.0f * radius[i] * std::cos(w);
+        b2[i] = -radius[i] * radius[i];
+        inputGain[i] = amplitude[i] * std::sin(w);
+    }
+}
+
+float SynthEngine::ModalBank::process(float frequency)
+{
+    using Register = juce::dsp::SIMDRegister<float>;
+    constexpr int width = static_cast<int>(Register::SIMDNumElements);
+    static_assert(LANE_BLOCK % width == 0);
+    
+    // Pitch modulation retunes at most once per control interval
+    if (--controlCounter <= 0)
+    {
+        controlCounter = CONTROL_INTERVAL;
+        if (std::abs(frequency - tunedFrequency) > tunedFrequency * 0.0003f)
+            tune(frequency);
+    }
+    
+    float excitation = 0.0f;
+    if (strikePosition < DSPTables::MALLET_LENGTH)
+        excitation = DSPTables::malletPulse[strikePosition++] * strikeLevel;
+    
+    Register sum(0.0f);
+    for (int i = 0; i < numLanes; i += width)
+    {
+        const auto previous = Register::fromRawArray(y1.data() + i);
+        const auto y = Register::fromRawArray(b1.data() + i) * previous
+                     + Register::fromRawArray(b2.data() + i) * Register::fromRawArray(y2.data() + i)
+                     + Register::fromRawArray(inputGain.data() + i) * excitation;
+        previous.copyToRawArray(y2.data() + i);
+        y.copyToRawArray(y1.data() + i);
+        sum += y;
+    }
+    
+    return sum.sum();
+}
+
+float SynthEngine::analogSaturate(float input)
+{
+    // Tube-style saturation with even harmonics
+    float x = input * 0.7f;
+    float x2 = x * x;
+    float x3 = x2 * x;
+    
+    // Add even harmonics for warmth
+    float output = x + x2 * 0.1f - x3 * 0.05f;
+    
+    return std::tanh(output * 1.5f) * 0.7f;
+}
+
+template <typename State>
+State& SynthEngine::freshState(State& state, uint32_t& stamp)
+{
+    // First use since the engine was retired: clear now unless it was
+    // scrubbed already. A zero stamp marks state that has never rendered.
+    if (stamp != modeArena.generation)
+    {
+        if (stamp != 0)
+        {
+            if constexpr (requires { state.clear(); })
+                state.clear();
+            else
+                state.reset();
+        }
+        stamp = modeArena.generation;
+    }
+    return state;
+}
+
+float SynthEngine::shape(int slot, int type, float input)
+{
+    auto& stage = freshState(shaperStages[currentVoice][slot], shaperGeneration[currentVoice][slot]);
+    const auto& table = sharedTables->shaperTables[type];
+    
+    switch (modeAntiAliasing[currentMode])
+    {
+        case AntiAliasADAA1:        return table.processFirstOrder(input, stage);
+        case AntiAliasADAA2:        return table.processSecondOrder(input, stage);
+        case AntiAliasOversample4x: return stage.oversampler.process(input, table.shaper);
+        default:                    return table.shaper(input);
     }
 }
 
-float SynthEngine::Reverb::process(float input)
+void SynthEngine::setModeAntiAliasing(int modeIndex, int method)
 {
-    float output = 0.0f;
+    if (modeIndex < 0 || modeIndex >= NumModes) return;
+    modeAntiAliasing[modeIndex] = juce::jlimit(0, NumAntiAliasMethods - 1, method);
+}
+
+int SynthEngine::getModeAntiAliasing(int modeIndex) const
+{
+    if (modeIndex < 0 || modeIndex >= NumModes) return AntiAliasNone;
+    return modeAntiAliasing[modeIndex];
+}
+
+void SynthEngine::AntiderivativeTable::build(float (*shaperFunction)(float))
+{
+    shaper = shaperFunction;
+    f.assign(SIZE, 0.0);
+    F1.assign(SIZE, 0.0);
+    F2.assign(SIZE, 0.0);
     
-    // Process comb filters in parallel
-    for (auto& comb : combs)
+    for (int i = 0; i < SIZE; i++)
     {
-        float y = comb.buffer[comb.index];
-        comb.lastOut = y * (1.0f - damping) + comb.lastOut * damping;
-        comb.buffer[comb.index] = input + comb.lastOut * comb.feedback * roomSize;
-        comb.index = (comb.index + 1) % comb.buffer.size();
-        output += y;
+        f[i] = shaper(static_cast<float>(-RANGE + i * STEP));
     }
     
-    output *= 0.125f; // Scale down
+    // F1 by Simpson's rule inside each cell (the shapers may have kinks)
+    const int subSteps = 16;
+    const double h = STEP / subSteps;
+    for (int i = 0; i < SIZE - 1; i++)
+    {
+        double x0 = -RANGE + i * STEP;
+        double area = 0.0;
+        for (int j = 0; j < subSteps; j++)
+        {
+            double a = x0 + j * h;
+            area += (shaper(static_cast<float>(a))
+                     + 4.0 * shaper(static_cast<float>(a + 0.5 * h))
+                     + shaper(static_cast<float>(a + h))) * h / 6.0;
+        }
+        F1[i + 1] = F1[i] + area;
+    }
     
-    // Process allpass filters in series
-    for (auto& allpass : allpasses)
+    // F2 integrates the Hermite interpolant of F1 exactly
+    for (int i = 0; i < SIZE - 1; i++)
     {
-        float bufOut = allpass.buffer[allpass.index];
-        float inSum = output + bufOut * allpass.feedback;
-        allpass.buffer[allpass.index] = inSum;
-        allpass.index = (allpass.index + 1) % allpass.buffer.size();
-        output = bufOut - inSum * allpass.feedback;
+        F2[i + 1] = F2[i] + STEP * (0.5 * (F1[i] + F1[i + 1]) + STEP * (f[i] - f[i + 1]) / 12.0);
     }
     
-    return output * wetLevel;
+    // Anchor both at x = 0 to keep the magnitudes small
+    const int centre = SIZE / 2;
+    double F1Centre = F1[centre];
+    double F2Centre = F2[centre];
+    for (int i = 0; i < SIZE; i++)
+    {
+        double x = -RANGE + i * STEP;
+        F1[i] -= F1Centre;
+        F2[i] -= F2Centre + F1Centre * x;
+    }
 }
 
-void SynthEngine::DelayLine::resize(int size)
+double SynthEngine::AntiderivativeTable::evalF1(double x) const
 {
-    buffer.resize(size, 0.0f);
-    writeIndex = 0;
+    if (x <= -RANGE)
+        return F1.front() + f.front() * (x + RANGE);
+    if (x >= RANGE)
+        return F1.back() + f.back() * (x - RANGE);
+    
+    double t = (x + RANGE) / STEP;
+    int i = std::min(static_cast<int>(t), SIZE - 2);
+    double u = t - i;
+    double u2 = u * u;
+    double u3 = u2 * u;
+    
+    return (2.0 * u3 - 3.0 * u2 + 1.0) * F1[i] + (u3 - 2.0 * u2 + u) * STEP * f[i]
+         + (-2.0 * u3 + 3.0 * u2) * F1[i + 1] + (u3 - u2) * STEP * f[i + 1];
 }
 
-float SynthEngine::DelayLine::process(float input)
+double SynthEngine::AntiderivativeTable::evalF2(double x) const
 {
-    if (buffer.empty()) return input;
-    
-    // Write input
-    buffer[writeIndex] = input;
-    
-    // Calculate read position
-    int delaySamples = static_cast<int>(time * 44100.0f);
-    int readIndex = writeIndex - delaySamples;
-    if (readIndex < 0) readIndex += buffer.size();
+    if (x <= -RANGE)
+    {
+        double d = x + RANGE;
+        return F2.front() + F1.front() * d + 0.5 * f.front() * d * d;
+    }
+    if (x >= RANGE)
+    {
+        double d = x - RANGE;
+        return F2.back() + F1.back() * d + 0.5 * f.back() * d * d;
+    }
     
-    // Read delayed signal
-    float delayed = buffer[readIndex];
+    double t = (x + RANGE) / STEP;
+    int i = std::min(static_cast<int>(t), SIZE - 2);
+    double u = t - i;
+    double u2 = u * u;
+    double u3 = u2 * u;
     
-    // Apply feedback
-    buffer[writeIndex] += delayed * feedback;
+    return (2.0 * u3 - 3.0 * u2 + 1.0) * F2[i] + (u3 - 2.0 * u2 + u) * STEP * F1[i]
+         + (-2.0 * u3 + 3.0 * u2) * F2[i + 1] + (u3 - u2) * STEP * F1[i + 1];
+}
+
+float SynthEngine::AntiderivativeTable::processFirstOrder(float input, ShaperStage& stage) const
+{
+    const double tolerance = 1.0e-4;
+    double x0 = input;
+    double dx = x0 - stage.x1;
     
-    // Update write position
-    writeIndex = (writeIndex + 1) % buffer.size();
+    double y = std::abs(dx) < tolerance
+        ? shaper(static_cast<float>(0.5 * (x0 + stage.x1)))
+        : (evalF1(x0) - evalF1(stage.x1)) / dx;
     
-    // Mix dry and wet
-    return input * (1.0f - mix) + delayed * mix;
+    stage.x2 = stage.x1;
+    stage.x1 = x0;
+    return static_cast<float>(y);
 }
 
-float SynthEngine::FMOperator::generate(float modulation)
+float SynthEngine::AntiderivativeTable::processSecondOrder(float input, ShaperStage& stage) const
 {
-    float out = std::sin(2.0f * juce::MathConstants<float>::pi * (phase + modulation + lastOutput * feedback));
-    lastOutput = out;
-    return out * amplitude;
+    const double tolerance = 1.0e-3;
+    double x0 = input;
+    double x1 = stage.x1;
+    double x2 = stage.x2;
+    
+    // Divided difference of F2 over the newest interval
+    double dx01 = x0 - x1;
+    double d0 = std::abs(dx01) < tolerance
+        ? evalF1(0.5 * (x0 + x1))
+        : (evalF2(x0) - evalF2(x1)) / dx01;
+    
+    double y = 0.0;
+    double dx02 = x0 - x2;
+    if (std::abs(dx02) < tolerance)
+    {
+        // Ill-conditioned: expand around the midpoint instead
+        double xBar = 0.5 * (x0 + x2);
+        double delta = xBar - x1;
+        y = std::abs(delta) < tolerance
+            ? shaper(static_cast<float>(0.5 * (xBar + x1)))
+            : 2.0 / delta * (evalF1(xBar) + (evalF2(x1) - evalF2(xBar)) / delta);
+    }
+    else
+    {
+        y = 2.0 / dx02 * (d0 - stage.d1);
+    }
+    
+    stage.d1 = d0;
+    stage.x2 = x1;
+    stage.x1 = x0;
+    return static_cast<float>(y);
 }
 
-void SynthEngine::KarplusStrong::setFrequency(float freq, float sampleRate)
+const std::array<float, SynthEngine::ShaperOversampler::TAPS>& SynthEngine::ShaperOversampler::coefficients()
 {
-    int size = static_cast<int>(sampleRate / freq);
-    if (size != delayLine.size())
+    // Kaiser-windowed sinc, passband to ~16 kHz, ~70 dB down by the base Nyquist
+    static const std::array<float, TAPS> taps = []
     {
-        delayLine.resize(size, 0.0f);
-        writeIndex = 0;
-    }
+        std::array<float, TAPS> h {};
+        const double cutoff = 0.108; // Cycles per oversampled sample
+        const double beta = 7.0;
+        auto besselI0 = [](double x)
+        {
+            double sum = 1.0, term = 1.0;
+            for (int k = 1; k < 32; k++)
+            {
+                term *= (x / (2.0 * k)) * (x / (2.0 * k));
+                sum += term;
+            }
+            return sum;
+        };
+        
+        double sum = 0.0;
+        for (int i = 0; i < TAPS; i++)
+        {
+            double m = i - 0.5 * (TAPS - 1);
+            double sinc = 2.0 * cutoff * (m == 0.0 ? 1.0 : std::sin(2.0 * M_PI * cutoff * m) / (2.0 * M_PI * cutoff * m));
+            double r = 2.0 * i / (TAPS - 1) - 1.0;
+            h[i] = static_cast<float>(sinc * besselI0(beta * std::sqrt(1.0 - r * r)) / besselI0(beta));
+            sum += h[i];
+        }
+        for (auto& tap : h)
+        {
+            tap = static_cast<float>(tap / sum);
+        }
+        return h;
+    }();
+    return taps;
 }
 
-float SynthEngine::KarplusStrong::process(float excitation)
+void SynthEngine::ShaperOversampler::reset()
 {
-    if (delayLine.empty()) return excitation;
-    
-    float output = delayLine[writeIndex];
+    inputHistory.fill(0.0f);
+    outputHistory.fill(0.0f);
+    inputIndex = 0;
+    outputIndex = 0;
+}
+
+float SynthEngine::ShaperOversampler::process(float input, float (*shaper)(float))
+{
+    const auto& h = coefficients();
     
-    // Karplus-Strong algorithm with damping
-    float filtered = (output + lastSample) * 0.5f * feedback * (1.0f - damping);
-    lastSample = output;
+    inputIndex = (inputIndex + PHASE_TAPS - 1) % PHASE_TAPS;
+    inputHistory[inputIndex] = inputHistory[inputIndex + PHASE_TAPS] = input;
+    const float* in = inputHistory.data() + inputIndex; // Newest first
     
-    delayLine[writeIndex] = excitation + filtered;
-    writeIndex = (writeIndex + 1) % delayLine.size();
+    for (int p = 0; p < FACTOR; p++)
+    {
+        // Polyphase interpolation: phase p uses taps p, p + 4, p + 8...
+        float up = 0.0f;
+        for (int j = 0; j < PHASE_TAPS; j++)
+        {
+            up += h[p + FACTOR * j] * in[j];
+        }
+        
+        outputIndex = (outputIndex + TAPS - 1) % TAPS;
+        outputHistory[outputIndex] = outputHistory[outputIndex + TAPS] = shaper(up * FACTOR);
+    }
     
+    // Decimate: only the kept output is filtered
+    const float* out = outputHistory.data() + outputIndex;
+    float output = 0.0f;
+    for (int i = 0; i < TAPS; i++)
+    {
+        output += h[i] * out[i];
+    }
     return output;
 }
 
-float SynthEngine::softClip(float input)
+void SynthEngine::ShaperStage::reset()
 {
-    if (std::abs(input) < 0.7f)
-        return input;
-    return std::tanh(input * 1.2f) * 0.8f;
+    x1 = x2 = d1 = 0.0;
+    oversampler.reset();
 }
 
-float SynthEngine::hardClip(float input)
+float SynthEngine::randomFloat()
 {
-    return std::max(-1.0f, std::min(1.0f, input));
+    return randomDist(rng);
 }
 
-float SynthEngine::analogSaturate(float input)
+float SynthEngine::fastSin(float cycles)
 {
-    // Tube-style saturation with even harmonics
-    float x = input * 0.7f;
-    float x2 = x * x;
-    float x3 = x2 * x;
+    // Wrap to [-0.5, 0.5) with integer truncation so the loop stays vectorizable
+    float x = cycles - static_cast<float>(static_cast<int>(cycles + 1024.5f) - 1024);
     
-    // Add even harmonics for warmth
-    float output = x + x2 * 0.1f - x3 * 0.05f;
+    // Fold into [-0.25, 0.25] where the odd Taylor series is accurate
+    x = x > 0.25f ? 0.5f - x : (x < -0.25f ? -0.5f - x : x);
     
-    return std::tanh(output * 1.5f) * 0.7f;
+    float s = x * 2.0f * juce::MathConstants<float>::pi;
+    float s2 = s * s;
+    return s * (1.0f + s2 * (-1.0f / 6.0f + s2 * (1.0f / 120.0f + s2 * (-1.0f / 5040.0f + s2 * (1.0f / 362880.0f)))));
 }
 
-float SynthEngine::randomFloat()
+float SynthEngine::polyBlep(float t, float dt)
 {
-    return randomDist(rng);
+    // Two-sample polynomial step residual around a wrap at t = 0. Written
+    // branch-free: only one of the two terms is non-zero (dt < 0.5).
+    const float before = std::max(0.0f, (t - 1.0f) / dt + 1.0f);
+    const float after = std::max(0.0f, 1.0f - t / dt);
+    return before * before - after * after;
+}
+
+float SynthEngine::polyBlepPulse(float t, float dt, float width)
+{
+    // Rising edge at 0, falling edge at width
+    float falling = t - width;
+    falling -= std::floor(falling);
+    
+    const float naive = t < width ? 1.0f : -1.0f;
+    return naive + polyBlep(t, dt) - polyBlep(falling, dt);
 }
 
 void SynthEngine::triggerGrain()
@@ -1070,7 +2601,7 @@ void SynthEngine::triggerGrain()
 void SynthEngine::updateHarmonics(float frequency, int mode)
 {
     // Update harmonic amplitudes based on mode
-    for (int i = 0; i < 32; i++)
+    for (size_t i = 0; i < harmonics.size(); i++)
     {
         harmonics[i].frequency = frequency * (i + 1);
         harmonics[i].amplitude = 1.0f / (i + 1);
@@ -1105,6 +2636,154 @@ void SynthEngine::applyShepardTone(float* harmonics, int numHarmonics, float pos
 }
 
 // Advanced processing implementations
+void SynthEngine::SpectralProcessor::initialize(const Window& sharedWindow, const juce::dsp::FFT& sharedFFT,
+                                                int frameOffset)
+{
+    window = &sharedWindow;
+    fft = &sharedFFT;
+    hopOffset = frameOffset;
+    dispersionTableAmount = 0.0f;
+    phases.fill(0);
+    clear();
+}
+
+void SynthEngine::SpectralProcessor::clear()
+{
+    spectrum.fill(0);
+    inputFifo.fill(0);
+    outputAccum.fill(0);
+    analysisPhases.fill(0);
+    synthesisPhases.fill(0);
+    fifoIndex = 0;
+    hopCounter = hopOffset;
+}
+
+float SynthEngine::SpectralProcessor::process(float input)
+{
+    inputFifo[fifoIndex] = input;
+    
+    float output = outputAccum[fifoIndex];
+    outputAccum[fifoIndex] = 0.0f;
+    
+    fifoIndex = (fifoIndex + 1) & (FFT_SIZE - 1);
+    
+    if (++hopCounter >= HOP_SIZE)
+    {
+        hopCounter = 0;
+        processFrame();
+    }
+    
+    return output;
+}
+
+void SynthEngine::SpectralProcessor::processFrame()
+{
+    // Unroll the input ring oldest-first and apply the analysis window
+    const auto& hann = *window;
+    for (int i = 0; i < FFT_SIZE; i++)
+    {
+        frame[i] = inputFifo[(fifoIndex + i) & (FFT_SIZE - 1)] * hann[i];
+    }
+    std::fill(frame.begin() + FFT_SIZE, frame.end(), 0.0f);
+    
+    fft->performRealOnlyForwardTransform(frame.data(), true);
+    
+    for (int k = 0; k < NUM_BINS; k++)
+    {
+        float re = frame[2 * k];
+        float im = frame[2 * k + 1];
+        float magnitude = std::sqrt(re * re + im * im);
+        
+        // Morph toward a slowly integrated copy of the spectrum
+        spectrum[k] = spectrum[k] * 0.95f + magnitude * 0.05f;
+        magnitudes[k] = magnitude + (spectrum[k] - magnitude) * morphPosition;
+        binPhases[k] = std::atan2(im, re);
+    }
+    
+    applyHarmonicShift(shiftAmount);
+    applyPhaseDispersion(warpAmount);
+    
+    for (int k = 0; k < NUM_BINS; k++)
+    {
+        frame[2 * k] = magnitudes[k] * std::cos(binPhases[k]);
+        frame[2 * k + 1] = magnitudes[k] * std::sin(binPhases[k]);
+    }
+    
+    fft->performRealOnlyInverseTransform(frame.data());
+    
+    // Hann squared at 75% overlap sums to 1.5
+    constexpr float overlapGain = 1.0f / 1.5f;
+    for (int i = 0; i < FFT_SIZE; i++)
+    {
+        outputAccum[(fifoIndex + i) & (FFT_SIZE - 1)] += frame[i] * hann[i] * overlapGain;
+    }
+}
+
+void SynthEngine::SpectralProcessor::processSpectralMorph(float* buffer, int size, float morph)
+{
+    morphPosition = morph;
+    for (int i = 0; i < size; i++)
+    {
+        buffer[i] = process(buffer[i]);
+    }
+}
+
+void SynthEngine::SpectralProcessor::applyPhaseDispersion(float amount)
+{
+    if (amount < 0.001f) return;
+    
+    // Rebuild the quadratic phase table only when the amount moves
+    if (std::abs(amount - dispersionTableAmount) > 0.001f)
+    {
+        dispersionTableAmount = amount;
+        for (int k = 0; k < NUM_BINS; k++)
+        {
+            // Group delay grows linearly with frequency, capped at a quarter frame
+            phases[k] = amount * juce::MathConstants<float>::pi * float(k * k) / float(NUM_BINS * 8);
+        }
+    }
+    
+    for (int k = 0; k < NUM_BINS; k++)
+    {
+        binPhases[k] += phases[k];
+    }
+}
+
+void SynthEngine::SpectralProcessor::applyHarmonicShift(float shift)
+{
+    if (std::abs(shift - 1.0f) < 0.001f) return;
+    
+    constexpr float twoPi = juce::MathConstants<float>::twoPi;
+    constexpr float expectedAdvance = twoPi * HOP_SIZE / FFT_SIZE;
+    
+    shiftedMagnitudes.fill(0);
+    shiftedFrequencies.fill(0);
+    
+    for (int k = 0; k < NUM_BINS; k++)
+    {
+        // Phase vocoder: recover the true frequency of each bin from its hop advance
+        float delta = binPhases[k] - analysisPhases[k] - k * expectedAdvance;
+        analysisPhases[k] = binPhases[k];
+        delta -= twoPi * std::round(delta / twoPi);
+        float trueBin = k + delta / expectedAdvance;
+        
+        int target = static_cast<int>(k * shift + 0.5f);
+        if (target >= NUM_BINS) continue;
+        
+        shiftedMagnitudes[target] += magnitudes[k];
+        shiftedFrequencies[target] = trueBin * shift;
+    }
+    
+    for (int k = 0; k < NUM_BINS; k++)
+    {
+        float phase = synthesisPhases[k] + shiftedFrequencies[k] * expectedAdvance;
+        synthesisPhases[k] = phase - twoPi * std::round(phase / twoPi);
+        binPhases[k] = synthesisPhases[k];
+    }
+    
+    magnitudes = shiftedMagnitudes;
+}
+
 float SynthEngine::BitCrusher::process(float input)
 {
     // Bit depth reduction
@@ -1168,6 +2847,259 @@ std::pair<float, float> SynthEngine::DimensionExpander::process(float input)
     return {input + diffused1 * 0.3f, input + diffused2 * 0.3f};
 }
 
+void SynthEngine::DiffusionNetwork::reset()
+{
+    lines.fill(0.0f);
+    feedback.fill(0.0f);
+    writeIndex.fill(0);
+    freezeAmount = 0.0f;
+}
+
+StereoFrame<float> SynthEngine::DiffusionNetwork::process(float input, bool frozen)
+{
+    using Register = juce::dsp::SIMDRegister<float>;
+    constexpr int width = static_cast<int>(Register::SIMDNumElements);
+    constexpr int mask = LINE_LENGTH - 1;
+    static_assert(LINES % width == 0);
+    static_assert((LINE_LENGTH & mask) == 0);
+    
+    // Freezing glides in over ~20 ms so the loop change does not click
+    freezeAmount += ((frozen ? 1.0f : 0.0f) - freezeAmount) * 0.001f;
+    const float inputGain = 1.0f - freezeAmount;
+    const float loopGain = decay + (0.99995f - decay) * freezeAmount;
+    const float lowpass = brightness + (1.0f - brightness) * freezeAmount;
+    
+    alignas(16) Lanes delayed;
+    for (int i = 0; i < LINES; i++)
+        delayed[i] = lines[i * LINE_LENGTH + ((writeIndex[i] - delays[i]) & mask)];
+    
+    // Allpass around each line: w = x + g d, y = d - g w
+    alignas(16) Lanes written;
+    alignas(16) Lanes outputs;
+    for (int i = 0; i < LINES; i += width)
+    {
+        const auto d = Register::fromRawArray(delayed.data() + i);
+        const auto w = Register::fromRawArray(feedback.data() + i) + input * inputGain + d * diffusion;
+        (d - w * diffusion).copyToRawArray(outputs.data() + i);
+        w.copyToRawArray(written.data() + i);
+    }
+    
+    for (int i = 0; i < LINES; i++)
+    {
+        lines[i * LINE_LENGTH + writeIndex[i]] = written[i];
+        writeIndex[i] = (writeIndex[i] + 1) & mask;
+    }
+    
+    // Householder mix (I - 2/N), lossless, then the loop's decay and damping
+    float sum = 0.0f;
+    for (const float y : outputs)
+        sum += y;
+    const float reflection = sum * (2.0f / LINES);
+    
+    for (int i = 0; i < LINES; i += width)
+    {
+        const auto mixed = (Register::fromRawArray(outputs.data() + i) - reflection) * loopGain;
+        const auto previous = Register::fromRawArray(feedback.data() + i);
+        (previous + (mixed - previous) * lowpass).copyToRawArray(feedback.data() + i);
+    }
+    
+    return { (outputs[0] + outputs[2]) * 0.5f, (outputs[1] + outputs[3]) * 0.5f };
+}
+
+void SynthEngine::MultibandDynamics::setCrossover(int numBands, float lowFrequency, float highFrequency)
+{
+    jassert(numBands == 2 || numBands == 3);
+    
+    for (int band = 0; band < LANES; band++)
+    {
+        for (int section = 0; section < NUM_SECTIONS; section++)
+            setSection(section, band, Silent, 0.0f);
+    }
+    
+    // Each LR4 filter is a squared Butterworth: two identical sections
+    if (numBands == 2)
+    {
+        for (int section = 0; section < 2; section++)
+        {
+            setSection(section, 0, Lowpass, lowFrequency);
+            setSection(section, 1, Highpass, lowFrequency);
+            setSection(section + 2, 0, Identity, 0.0f);
+            setSection(section + 2, 1, Identity, 0.0f);
+        }
+    }
+    else
+    {
+        for (int section = 0; section < 2; section++)
+        {
+            setSection(section, 0, Lowpass, lowFrequency);
+            setSection(section, 1, Highpass, lowFrequency);
+            setSection(section, 2, Highpass, lowFrequency);
+            setSection(section + 2, 1, Lowpass, highFrequency);
+            setSection(section + 2, 2, Highpass, highFrequency);
+        }
+        
+        // An LR4 pair sums to one 2nd-order allpass
+        setSection(2, 0, Allpass, highFrequency);
+        setSection(3, 0, Identity, 0.0f);
+    }
+    
+    reset();
+}
+
+void SynthEngine::MultibandDynamics::setSection(int section, int band, Response response, float frequency)
+{
+    auto& s = sections[section];
+    
+    if (response == Silent || response == Identity)
+    {
+        s.b0[band] = response == Identity ? 1.0f : 0.0f;
+        s.b1[band] = s.b2[band] = s.a1[band] = s.a2[band] = 0.0f;
+        return;
+    }
+    
+    // Bilinear Butterworth, Q = 1/sqrt(2)
+    const float k = std::tan(juce::MathConstants<float>::pi * frequency / 44100.0f);
+    const float k2 = k * k;
+    const float norm = 1.0f / (1.0f + juce::MathConstants<float>::sqrt2 * k + k2);
+    
+    s.a1[band] = 2.0f * (k2 - 1.0f) * norm;
+    s.a2[band] = (1.0f - juce::MathConstants<float>::sqrt2 * k + k2) * norm;
+    
+    switch (response)
+    {
+        case Lowpass:
+            s.b0[band] = k2 * norm;
+            s.b1[band] = 2.0f * k2 * norm;
+            s.b2[band] = k2 * norm;
+            break;
+            
+        case Highpass:
+            s.b0[band] = norm;
+            s.b1[band] = -2.0f * norm;
+            s.b2[band] = norm;
+            break;
+            
+        default:
+            s.b0[band] = s.a2[band];
+            s.b1[band] = s.a1[band];
+            s.b2[band] = 1.0f;
+            break;
+    }
+}
+
+void SynthEngine::MultibandDynamics::setBand(int band, float bandDrive, float bandThreshold, float bandRatio, float level)
+{
+    // The saturator's small-signal gain is 1.5 * drive
+    drive[band] = bandDrive;
+    makeup[band] = level / (1.5f * bandDrive);
+    threshold[band] = bandThreshold;
+    ratio[band] = std::max(1.0f, bandRatio);
+}
+
+void SynthEngine::MultibandDynamics::setRelease(float seconds)
+{
+    release = std::exp(-1.0f / (seconds * 44100.0f));
+}
+
+void SynthEngine::MultibandDynamics::reset()
+{
+    for (auto& section : sections)
+    {
+        section.s1.fill(0.0f);
+        section.s2.fill(0.0f);
+    }
+    envelope.fill(0.0f);
+    gain.fill(1.0f);
+    gainStep.fill(0.0f);
+    controlCounter = 0;
+}
+
+void SynthEngine::MultibandDynamics::updateGains()
+{
+    // Each band's gain ramps to its new target over the coming interval
+    for (int band = 0; band < LANES; band++)
+    {
+        float target = 1.0f;
+        if (envelope[band] > threshold[band])
+            target = std::pow(envelope[band] / threshold[band], 1.0f / ratio[band] - 1.0f);
+        gainStep[band] = (target - gain[band]) / float(CONTROL_INTERVAL);
+    }
+}
+
+float SynthEngine::MultibandDynamics::process(float input)
+{
+    using Register = juce::dsp::SIMDRegister<float>;
+    constexpr int width = static_cast<int>(Register::SIMDNumElements);
+    static_assert(LANES % width == 0);
+    
+    if (--controlCounter <= 0)
+    {
+        controlCounter = CONTROL_INTERVAL;
+        updateGains();
+    }
+    
+    Register sum(0.0f);
+    for (int i = 0; i < LANES; i += width)
+    {
+        // Every band filters the same input through its own chain
+        Register x(input);
+        for (auto& s : sections)
+        {
+            const auto y = Register::fromRawArray(s.b0.data() + i) * x + Register::fromRawArray(s.s1.data() + i);
+            const auto s1 = Register::fromRawArray(s.b1.data() + i) * x - Register::fromRawArray(s.a1.data() + i) * y
+                          + Register::fromRawArray(s.s2.data() + i);
+            const auto s2 = Register::fromRawArray(s.b2.data() + i) * x - Register::fromRawArray(s.a2.data() + i) * y;
+            s1.copyToRawArray(s.s1.data() + i);
+            s2.copyToRawArray(s.s2.data() + i);
+            x = y;
+        }
+        
+        // Cubic soft clip, flat at +-1 beyond the clamp
+        auto driven = x * Register::fromRawArray(drive.data() + i);
+        driven = Register::min(Register(1.0f), Register::max(Register(-1.0f), driven));
+        const auto saturated = driven * (Register(1.5f) - driven * driven * 0.5f);
+        
+        const auto level = Register::max(Register::abs(saturated), Register::fromRawArray(envelope.data() + i) * release);
+        level.copyToRawArray(envelope.data() + i);
+        
+        const auto bandGain = Register::fromRawArray(gain.data() + i) + Register::fromRawArray(gainStep.data() + i);
+        bandGain.copyToRawArray(gain.data() + i);
+        
+        sum += saturated * bandGain * Register::fromRawArray(makeup.data() + i);
+    }
+    
+    return sum.sum();
+}
+
+void SynthEngine::ModeStateArena::allocate()
+{
+    int total = 0;
+    for (int region = 0; region < NumRegions; region++)
+    {
+        offsets[region] = total;
+        total += (regionSizes[region] + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+    
+    // Over-allocate so the base can be rounded up to a cache line
+    storage.assign(static_cast<size_t>(total + ALIGNMENT), 0.0f);
+    const auto address = reinterpret_cast<std::uintptr_t>(storage.data());
+    const auto alignBytes = static_cast<std::uintptr_t>(ALIGNMENT * sizeof(float));
+    base = reinterpret_cast<float*>((address + alignBytes - 1) / alignBytes * alignBytes);
+    
+    regionGeneration.fill(generation);
+}
+
+float* SynthEngine::ModeStateArena::acquire(Region region)
+{
+    float* data = base + offsets[region];
+    if (regionGeneration[region] != generation)
+    {
+        std::fill_n(data, regionSizes[region], 0.0f);
+        regionGeneration[region] = generation;
+    }
+    return data;
+}
+
 SynthEngine::ModeInfo SynthEngine::getModeInfo(int modeIndex)
 {
     if (modeIndex >= 0 && modeIndex < NumModes)
@@ -1187,51 +3119,67 @@ juce::StringArray SynthEngine::getModeNames()
 
 void SynthEngine::setReverbParameters(float size, float mix)
 {
-    reverb.roomSize = size;
-    reverb.wetLevel = mix;
+    masterReverb.roomSize = size;
+    masterReverb.wetLevel = mix;
     reverbMixLevel = mix;
 }
 
 void SynthEngine::setChorusParameters(float rate, float depth, float mix)
 {
-    chorus.rate = rate;
-    chorus.depth = depth;
-    chorus.mix = mix;
+    for (auto* side : { &masterChorusLeft, &masterChorusRight })
+    {
+        side->rate = rate;
+        side->depth = depth;
+        side->mix = mix;
+    }
     chorusMixLevel = mix;
 }
 
 void SynthEngine::setDelayParameters(float time, float feedback, float mix)
 {
-    delay.time = time;
-    delay.feedback = feedback;
-    delay.mix = mix;
+    masterDelay.time = time;
+    masterDelay.feedback = feedback;
+    masterDelay.mix = mix;
     delayMixLevel = mix;
 }
 
-float SynthEngine::processEffects(float input)
+template <typename SampleType>
+StereoFrame<SampleType> SynthEngine::processEffects(StereoFrame<SampleType> input)
 {
-    float output = input;
+    using Frame = StereoFrame<double>;
+    Frame output(input);
+    
+    // Only engines with a prepared master chain process effects
+    if (masterDelay.buffer.empty())
+        return input;
     
-    // Apply chorus if enabled
+    // Apply chorus if enabled; the two sides run with quadrature LFOs
     if (chorusMixLevel > 0.001f)
     {
-        float chorusOut = chorus.process(input);
-        output = input * (1.0f - chorusMixLevel) + chorusOut * chorusMixLevel;
+        const Frame chorusMix = chorusMixLevel;
+        Frame chorusOut(masterChorusLeft.process(static_cast<float>(output.left)),
+                        masterChorusRight.process(static_cast<float>(output.right)));
+        output = output * (Frame(1.0) - chorusMix) + chorusOut * chorusMix;
     }
     
     // Apply delay if enabled
     if (delayMixLevel > 0.001f)
     {
-        float delayOut = delay.process(output);
-        output = output * (1.0f - delayMixLevel) + delayOut * delayMixLevel;
+        const Frame delayMix = delayMixLevel;
+        Frame delayOut = masterDelay.processSample(output);
+        output = output * (Frame(1.0) - delayMix) + delayOut * delayMix;
     }
     
     // Apply reverb if enabled
     if (reverbMixLevel > 0.001f)
     {
-        float reverbOut = reverb.process(output);
-        output = output * (1.0f - reverbMixLevel) + reverbOut * reverbMixLevel;
+        const Frame reverbMix = reverbMixLevel;
+        Frame reverbOut = masterReverb.processSample(output);
+        output = output * (Frame(1.0) - reverbMix) + reverbOut * reverbMix;
     }
     
-    return output;
-}
\ No newline at end of file
+    return StereoFrame<SampleType>(output);
+}
+
+template StereoFrame<float> SynthEngine::processEffects<float>(StereoFrame<float>);
+template StereoFrame<double> SynthEngine::processEffects<double>(StereoFrame<double>);
\ No newline at end of file
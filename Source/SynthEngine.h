@@ -2,11 +2,40 @@
 
 #include <juce_core/juce_core.h>
 #include <juce_gui_basics/juce_gui_basics.h>
+#include <juce_dsp/juce_dsp.h>
+#include "DSPTables.h"
 #include <array>
 #include <cmath>
 #include <vector>
 #include <random>
 
+// Interleaved L/R pair. The two channels sit in adjacent lanes so the
+// element-wise maths below compiles to one SIMD operation per pair.
+template <typename T>
+struct alignas(2 * sizeof(T)) StereoFrame
+{
+    T left = 0;
+    T right = 0;
+    
+    constexpr StereoFrame() = default;
+    constexpr StereoFrame(T mono) : left(mono), right(mono) {}
+    constexpr StereoFrame(T l, T r) : left(l), right(r) {}
+    
+    template <typename U>
+    explicit constexpr StereoFrame(const StereoFrame<U>& other)
+        : left(static_cast<T>(other.left)), right(static_cast<T>(other.right)) {}
+    
+    StereoFrame& operator+=(const StereoFrame& other) { left += other.left; right += other.right; return *this; }
+    StereoFrame& operator-=(const StereoFrame& other) { left -= other.left; right -= other.right; return *this; }
+    StereoFrame& operator*=(const StereoFrame& other) { left *= other.left; right *= other.right; return *this; }
+    
+    friend StereoFrame operator+(StereoFrame a, const StereoFrame& b) { return a += b; }
+    friend StereoFrame operator-(StereoFrame a, const StereoFrame& b) { return a -= b; }
+    friend StereoFrame operator*(StereoFrame a, const StereoFrame& b) { return a *= b; }
+    
+    T mid() const { return (left + right) * T(0.5); }
+};
+
 class SynthEngine
 {
 public:
@@ -25,6 +54,23 @@ public:
         NumModes
     };
     
+    enum FilterDriveMode
+    {
+        DriveTanh = 0,
+        DriveAsymmetric,
+        DriveHardClip,
+        NumDriveModes
+    };
+    
+    enum AntiAliasMethod
+    {
+        AntiAliasNone = 0,
+        AntiAliasADAA1,
+        AntiAliasADAA2,
+        AntiAliasOversample4x,
+        NumAntiAliasMethods
+    };
+    
     struct ModeInfo
     {
         juce::String name;
@@ -35,11 +81,18 @@ public:
         juce::Colour accentColor;
     };
     
+    // Polyphony shared with the processor; per-voice state is sized by it
+    static constexpr int MAX_VOICES = 8;
+    
     SynthEngine();
     ~SynthEngine() = default;
     
     // Generate a sample for the current mode
-    float generateSample(float phase, float frequency, int modeIndex);
+    StereoFrame<float> generateSample(float phase, float frequency, int modeIndex, int voiceIndex = 0);
+    
+    // Per-voice note events for modes with their own envelopes
+    void noteOn(int voiceIndex, float noteVelocity);
+    void noteOff(int voiceIndex);
     
     // Get mode information
     static ModeInfo getModeInfo(int modeIndex);
@@ -48,35 +101,199 @@ public:
     // Reset internal state
     void reset();
     
+    // Reset only the state the modes render from; voice filters and the
+    // master effects keep running. Allocation free, safe on the audio thread.
+    // Buffers are not cleared here: an engine retired and scrubbed while idle
+    // starts clean, anything still stale clears on its first use.
+    void resetModeState();
+    
+    // Call when the engine stops rendering. Constant time: marks every mode
+    // buffer stale.
+    void retireModeState();
+    
+    // Clears the next stale buffer the engine owns, one per call, so an idle
+    // engine can be cleaned a sub-block at a time. Returns false once done.
+    bool scrubModeState();
+    
+    // State used by a single mode is allocated here rather than with the
+    // engine. Call off the audio thread; an unprepared mode renders silence.
+    void prepareMode(int modeIndex);
+    void releaseMode(int modeIndex);
+    bool isModePrepared(int modeIndex) const;
+    
+    // Bit mask of the modes this engine may render. resetModeState() and
+    // noteOn() only touch per-mode allocations of these modes, so the others
+    // can be prepared or released meanwhile. Audio thread; defaults to all.
+    void setRenderModes(uint32_t modeMask) { renderModes = modeMask; }
+    
+    // Only the engine that runs processEffects() needs the master chain
+    void prepareMasterEffects();
+    
+    // Bytes held by this engine, inline and on the heap. FFT tables are estimated.
+    size_t getMemoryUsage() const;
+    
     // Set velocity for expression
     void setVelocity(float vel) { velocity = vel; }
     
+    // Host sample rate, for the filters whose cutoff is set in Hz by the
+    // processor or must track the host's phase. Call off the audio thread.
+    void setSampleRate(double newSampleRate);
+    
+    // Per-voice ladder filter. Coefficients are expected at control rate;
+    // processVoiceFilters runs every voice lane in one pass.
+    void setVoiceFilter(int voiceIndex, float cutoff, float resonance, float drive);
+    void setFilterDriveMode(int mode) { voiceLadders.driveMode = juce::jlimit(0, NumDriveModes - 1, mode); }
+    StereoFrame<float> processVoiceFilter(int voiceIndex, StereoFrame<float> input);
+    void processVoiceFilters(StereoFrame<float>* voiceFrames);
+    
+    // How each mode's saturation stages are de-aliased
+    void setModeAntiAliasing(int modeIndex, int method);
+    int getModeAntiAliasing(int modeIndex) const;
+    
     // Effects control
     void setReverbParameters(float size, float mix);
     void setChorusParameters(float rate, float depth, float mix);
     void setDelayParameters(float time, float feedback, float mix);
-    float processEffects(float input);
+    
+    // Unison stage: sub-voice count, total detune in cents, stereo spread
+    // (0-1) and how far note-on phases are randomised (0-1)
+    void setUnisonParameters(int subVoices, float detuneCents, float spread, float phaseRandomness);
+    
+    // Crystalline's FM tine: an index into fmAlgorithmTable. Routing changes
+    // at once; carrier and modulator levels follow at the next note-on.
+    void setFMAlgorithm(int algorithm);
+    
+    // Solar Wind: hold the diffusion networks' current contents
+    void setSolarFreeze(bool freeze) { solarFrozen = freeze; }
+    
+    // Master stereo effects chain, instantiated for float and double hosts
+    template <typename SampleType>
+    StereoFrame<SampleType> processEffects(StereoFrame<SampleType> input);
     
 private:
     // Synthesis modes
     float generateCrystalline(float phase, float frequency);
-    float generateSilkPad(float phase, float frequency);
+    StereoFrame<float> generateSilkPad(float phase, float frequency);
     float generateNebulaDrift(float phase, float frequency);
     float generateLiquidBass(float phase, float frequency);
     float generatePlasmaCore(float phase, float frequency);
     float generateCloudNine(float phase, float frequency);
     float generateQuantumFlux(float phase, float frequency);
     float generateCrystalMatrix(float phase, float frequency);
-    float generateSolarWind(float phase, float frequency);
-    float generateVoidResonance(float phase, float frequency);
+    StereoFrame<float> generateSolarWind(float phase, float frequency);
+    StereoFrame<float> generateVoidResonance(float phase, float frequency);
     
     // Professional synthesis components
     struct Layer {
         float phase = 0.0f;
         float frequency = 1.0f;
         float amplitude = 1.0f;
-        float detune = 0.0f;
-        float pan = 0.0f;
+    };
+    
+    // Up to 16 detuned, panned copies of one PolyBLEP saw. Sub-voices are laid
+    // out SoA and packed into SIMD registers a block of 8 at a time, so 8-voice
+    // unison costs two 4-wide register passes. Unused lanes carry zero gain.
+    struct UnisonOscillator {
+        static constexpr int MAX_SUB_VOICES = 16;
+        static constexpr int LANE_BLOCK = 8;
+        
+        alignas(32) std::array<float, MAX_SUB_VOICES> phase {};
+        alignas(32) std::array<float, MAX_SUB_VOICES> ratio {};
+        alignas(32) std::array<float, MAX_SUB_VOICES> gainLeft {};
+        alignas(32) std::array<float, MAX_SUB_VOICES> gainRight {};
+        alignas(32) std::array<float, MAX_SUB_VOICES> inverseRatio {};
+        int numSubVoices = 1;
+        
+        void configure(int subVoices, float detuneCents, float spread);
+        void restart(float randomness, std::mt19937& random);
+        StereoFrame<float> processSaw(float frequency);
+        
+        template <int Lanes> StereoFrame<float> processSawLanes(float increment);
+    };
+    
+    // Plasma Core's voice: two sine operators cross-modulating each other, a
+    // Chebyshev harmonic shaper and a tube saturator, all run at 2x or 4x the
+    // host rate on table sines. A polyphase decimator brings the result back
+    // down; nothing else in the core runs at the host rate.
+    struct CrossFMCore {
+        static constexpr int MAX_FACTOR = 4;
+        static constexpr int BRANCH_TAPS = DSPTables::DECIMATOR_BRANCH_TAPS;
+        
+        float phaseA = 0.0f;
+        float phaseB = 0.0f;
+        float lastA = 0.0f;
+        float lastB = 0.0f;
+        int factor = 0;
+        
+        // One decimator branch per oversampled phase, stored twice so every
+        // read is one contiguous run
+        std::array<std::array<float, BRANCH_TAPS * 2>, MAX_FACTOR> history {};
+        int historyIndex = 0;
+        
+        void restart();
+        void reset();
+        
+        // depth is the cross-modulation index in cycles, morph fades the
+        // shaper from odd to even harmonics and warp (0-2) bends the peaks
+        float process(int oversampling, float increment, float depth, float morph, float warp);
+        
+        template <int Factor> float processOversampled(float increment, float depth, float morph, float warp);
+        static float tableSine(float cycles);
+        static float saturate(float input);
+    };
+    
+    // Liquid Bass's voice. The sub is derived from the voice's own phase so it
+    // stays locked an octave below the fundamental. The ladder follows an
+    // attack/release envelope of its input; the envelope and the ladder
+    // coefficient update every CONTROL_INTERVAL samples and the coefficient
+    // ramps linearly in between.
+    struct BassVoice {
+        static constexpr int CONTROL_INTERVAL = 32;
+        
+        float lastPhase = 0.0f;
+        float subHalf = 0.0f;       // 0 or 0.5: which half of the sub cycle we are in
+        float rectifiedSum = 0.0f;  // |input| accumulated over the current interval
+        float envelope = 0.0f;
+        float ladderG = 0.0f;
+        float ladderStep = 0.0f;
+        float stage[4] = {0, 0, 0, 0};
+        int controlCounter = 0;
+        float sampleRate = 44100.0f;
+        
+        void restart();
+        void reset();
+        
+        float oscillate(float phase);
+        float filter(float input, float resonance);
+        float ladderCoefficient(float cutoff) const;
+    };
+    
+    // Minimum-phase band-limited step residual (minBLEP - 1), for
+    // discontinuities whose timing is only known after the fact, such as hard
+    // sync resets. Built once per process; see SharedTables.
+    struct MinBlep {
+        static constexpr int ZERO_CROSSINGS = 16;
+        static constexpr int OVERSAMPLING = 64;
+        static constexpr int LENGTH = 2 * ZERO_CROSSINGS;          // Samples one step touches
+        static constexpr int TABLE_SIZE = LENGTH * OVERSAMPLING;
+        using Table = std::array<float, TABLE_SIZE + 1>;           // Guard point for interpolation
+        
+        static void build(Table& table);
+    };
+    
+    // Hard-synced saw: the slave restarts whenever the master wraps. Both the
+    // sync resets and the slave's own wraps are corrected with minBLEPs.
+    struct SyncOscillator {
+        float masterPhase = 0.0f;
+        float slavePhase = 0.0f;
+        std::array<float, MinBlep::LENGTH> correction {};
+        int readIndex = 0;
+        const MinBlep::Table* residual = nullptr; // Shared, see SharedTables
+        
+        void initialize(const MinBlep::Table& sharedResidual);
+        void reset();
+        float process(float masterIncrement, float slaveIncrement);
+        void addStep(float samplesAgo, float height);
     };
     
     struct Filter {
@@ -84,10 +301,13 @@ private:
         float low = 0, band = 0, high = 0, notch = 0;
         float f = 0.1f, q = 1.0f;
         
-        // Moog ladder filter state
+        // Ladder filter state (four TPT one-poles, zero-delay feedback)
         float stage[4] = {0, 0, 0, 0};
-        float delay[4] = {0, 0, 0, 0};
         float feedback = 0.0f;
+        float ladderG = 0.0f;
+        float ladderCutoff = -1.0f;
+        float ladderResonance = -1.0f;
+        int ladderCountdown = 0;
         
         void setStateVariable(float frequency, float resonance, float sampleRate);
         float processLowpass(float input);
@@ -99,6 +319,88 @@ private:
         float processMoogLadder(float input);
     };
     
+    // The same ladder with one lane per voice channel, interleaved L/R by
+    // voice. Lanes are laid out SoA so the per-sample loop vectorizes 4 or 8
+    // lanes per register.
+    struct LadderFilterBank {
+        static constexpr int LANES = MAX_VOICES * 2;
+        
+        alignas(32) std::array<float, LANES> g {};
+        alignas(32) std::array<float, LANES> k {};
+        alignas(32) std::array<float, LANES> inputGain {};
+        alignas(32) std::array<float, LANES> outputGain {};
+        alignas(32) std::array<float, LANES> s1 {};
+        alignas(32) std::array<float, LANES> s2 {};
+        alignas(32) std::array<float, LANES> s3 {};
+        alignas(32) std::array<float, LANES> s4 {};
+        int driveMode = DriveTanh;
+        
+        void setCoefficients(int lane, float cutoff, float resonance, float drive, float sampleRate);
+        void resetLane(int lane);
+        float processLane(int lane, float input);
+        void process(float* samples);
+        
+        template <int Mode> void processLanes(float* samples);
+    };
+    
+    enum ShaperType
+    {
+        ShapeAnalogSaturate = 0,
+        NumShapers
+    };
+    
+    // Call sites that keep their own shaper history
+    enum ShaperSlot
+    {
+        SlotSaturate = 0,
+        NumShaperSlots
+    };
+    
+    // 4x polyphase FIR oversampler around a memoryless shaper
+    struct ShaperOversampler {
+        static constexpr int FACTOR = 4;
+        static constexpr int TAPS = 128;
+        static constexpr int PHASE_TAPS = TAPS / FACTOR;
+        
+        // Histories are stored twice so every read is one contiguous run
+        std::array<float, PHASE_TAPS * 2> inputHistory {};
+        std::array<float, TAPS * 2> outputHistory {};
+        int inputIndex = 0;
+        int outputIndex = 0;
+        
+        static const std::array<float, TAPS>& coefficients();
+        void reset();
+        float process(float input, float (*shaper)(float));
+    };
+    
+    struct ShaperStage {
+        double x1 = 0.0;
+        double x2 = 0.0;
+        double d1 = 0.0; // Previous ADAA2 divided difference
+        ShaperOversampler oversampler;
+        
+        void reset();
+    };
+    
+    // First and second antiderivatives of a shaper, tabulated once and read
+    // back with cubic Hermite interpolation (the slopes are exact: F1' = f,
+    // F2' = F1). Beyond the table the shapers are flat, so F1/F2 continue
+    // as linear/quadratic tails.
+    struct AntiderivativeTable {
+        static constexpr int SIZE = 4097;
+        static constexpr double RANGE = 16.0;
+        static constexpr double STEP = 2.0 * RANGE / (SIZE - 1);
+        
+        float (*shaper)(float) = nullptr;
+        std::vector<double> f, F1, F2;
+        
+        void build(float (*shaperFunction)(float));
+        double evalF1(double x) const;
+        double evalF2(double x) const;
+        float processFirstOrder(float input, ShaperStage& stage) const;
+        float processSecondOrder(float input, ShaperStage& stage) const;
+    };
+    
     struct Envelope {
         float attack = 0.01f;
         float decay = 0.1f;
@@ -130,65 +432,122 @@ private:
         float process(float input);
     };
     
+    // Long-feedback structures are templated on sample type. The engine
+    // keeps them in double so recirculating rounding error stays inaudible;
+    // process() converts at the call site's own sample type.
+    template <typename SampleType>
     struct Reverb {
         static constexpr int NUM_COMBS = 8;
         static constexpr int NUM_ALLPASS = 4;
         
         struct CombFilter {
-            std::vector<float> buffer;
+            std::vector<SampleType> buffer;
             int index = 0;
             float feedback = 0.8f;
             float damp = 0.2f;
-            float lastOut = 0.0f;
+            SampleType lastOut = 0;
         };
         
         struct AllpassFilter {
-            std::vector<float> buffer;
+            std::vector<SampleType> buffer;
             int index = 0;
             float feedback = 0.5f;
         };
         
         CombFilter combs[NUM_COMBS];
         AllpassFilter allpasses[NUM_ALLPASS];
+        SampleType allpassPolarity = SampleType(1); // Per-lane sign; opposing signs decorrelate a stereo pair
         float roomSize = 0.5f;
         float damping = 0.5f;
         float wetLevel = 0.3f;
         
         void initialize();
-        float process(float input);
+        void clear();
+        SampleType processSample(SampleType input);
+        
+        template <typename T>
+        T process(T input) { return static_cast<T>(processSample(static_cast<SampleType>(input))); }
     };
     
+    template <typename SampleType>
     struct DelayLine {
-        std::vector<float> buffer;
+        std::vector<SampleType> buffer;
         int writeIndex = 0;
         float feedback = 0.4f;
         float time = 0.25f; // in seconds
         float mix = 0.2f;
         
         void resize(int size);
-        float process(float input);
+        void clear();
+        SampleType processSample(SampleType input);
+        
+        template <typename T>
+        T process(T input) { return static_cast<T>(processSample(static_cast<SampleType>(input))); }
     };
     
     // Wavetable oscillator for high-quality waveforms
     struct WavetableOscillator {
-        static constexpr int TABLE_SIZE = 2048;
-        static constexpr int NUM_TABLES = 16;
-        std::array<std::array<float, TABLE_SIZE>, NUM_TABLES> tables;
+        static constexpr int TABLE_SIZE = DSPTables::WAVETABLE_SIZE;
+        static constexpr int NUM_TABLES = DSPTables::NUM_WAVETABLES;
+        
+        // Tables are generated at compile time, see DSPTables.h
         float morphPosition = 0.0f;
         
-        void initialize();
         float generate(float phase);
     };
     
-    // FM operator for electric piano sounds
+    // FM operator patch for electric piano sounds
     struct FMOperator {
-        float phase = 0.0f;
-        float frequency = 1.0f;
+        float ratio = 1.0f;
         float amplitude = 1.0f;
         float feedback = 0.0f;
-        float lastOutput = 0.0f;
+        float attack = 0.002f;
+        float decay = 1.0f;
+        float sustain = 0.5f;
+        float release = 0.3f;
+    };
+    
+    // Operator routing, DX7-style. Bit j of modulators[i] means operator j
+    // modulates operator i.
+    struct FMAlgorithm {
+        std::array<uint8_t, 6> modulators;
+        uint8_t carriers;
+        int feedbackOperator;
+    };
+    
+    // 6-operator FM voice. Operators sit in lanes padded to 8 and advance
+    // together: routing is a modulation matrix applied to the previous
+    // sample's outputs, so the phase/sine kernel vectorizes across operators.
+    struct FMVoice {
+        static constexpr int NUM_OPERATORS = 6;
+        static constexpr int NUM_LANES = 8;
+        static constexpr int CONTROL_INTERVAL = 16;
+        
+        enum EnvelopeStage { Idle = 0, Attack, Decay, Release };
         
-        float generate(float modulation = 0.0f);
+        alignas(32) std::array<float, NUM_LANES> phase {};
+        alignas(32) std::array<float, NUM_LANES> increment {};
+        alignas(32) std::array<float, NUM_LANES> level {};
+        alignas(32) std::array<float, NUM_LANES> output {};
+        alignas(32) std::array<float, NUM_LANES> envLevel {};
+        alignas(32) std::array<float, NUM_LANES> envTarget {};
+        alignas(32) std::array<float, NUM_LANES> envCoeff {};
+        alignas(32) std::array<float, NUM_LANES> carrierGain {};
+        alignas(32) std::array<std::array<float, NUM_LANES>, NUM_LANES> modMatrix {}; // [source][target]
+        std::array<int, NUM_LANES> envStage {};
+        std::array<float, NUM_LANES> ratio {};
+        std::array<float, NUM_LANES> decayCoeff {};
+        std::array<float, NUM_LANES> sustainLevel {};
+        std::array<float, NUM_LANES> releaseCoeff {};
+        float frequency = 0.0f;
+        int controlCounter = 0;
+        
+        void setAlgorithm(const FMAlgorithm& algorithm, const std::array<FMOperator, NUM_OPERATORS>& ops);
+        void noteOn(const std::array<FMOperator, NUM_OPERATORS>& ops, float velocity);
+        void noteOff();
+        void reset();
+        void updateControl(float newFrequency);
+        float process(float newFrequency);
     };
     
     // Additive synthesis for brass
@@ -198,6 +557,61 @@ private:
         float phase = 0.0f;
     };
     
+    // Additive resynthesis. Partial amplitudes are set at control rate and
+    // rendered by a quadrature oscillator bank (one complex rotation per
+    // partial, vectorized across partials), or by inverse-FFT overlap-add once
+    // the partial count reaches IFFT_THRESHOLD and the FFT becomes cheaper.
+    struct AdditiveOscillator {
+        static constexpr int MAX_PARTIALS = 128;
+        static constexpr int IFFT_THRESHOLD = 64;
+        static constexpr int CONTROL_INTERVAL = 32;
+        static constexpr int FFT_ORDER = 9;
+        static constexpr int FFT_SIZE = 1 << FFT_ORDER;
+        static constexpr int HOP_SIZE = FFT_SIZE / 2;
+        static constexpr int KERNEL_BINS = 6;
+        static constexpr int KERNEL_OVERSAMPLE = 32;
+        static constexpr int KERNEL_SIZE = KERNEL_BINS * KERNEL_OVERSAMPLE + 2;
+        using Kernel = std::array<float, KERNEL_SIZE>;
+        
+        alignas(32) std::array<float, MAX_PARTIALS> ratio {};
+        alignas(32) std::array<float, MAX_PARTIALS> targetAmplitude {};
+        alignas(32) std::array<float, MAX_PARTIALS> amplitude {};
+        alignas(32) std::array<float, MAX_PARTIALS> amplitudeStep {};
+        alignas(32) std::array<float, MAX_PARTIALS> oscSin {};
+        alignas(32) std::array<float, MAX_PARTIALS> oscCos {};
+        alignas(32) std::array<float, MAX_PARTIALS> rotSin {};
+        alignas(32) std::array<float, MAX_PARTIALS> rotCos {};
+        std::array<float, MAX_PARTIALS> framePhase {};
+        int numPartials = 0;
+        float frequency = 0.0f;
+        int controlCounter = 0;
+        bool rotationDirty = true;
+        bool useInverseFFT = false;
+        
+        // Inverse-FFT path: Hann-windowed frames at 50% overlap
+        const juce::dsp::FFT* fft = nullptr; // Shared by the engine's voices
+        std::array<float, FFT_SIZE * 2> frame {};
+        std::array<float, FFT_SIZE> olaBuffer {};
+        const Kernel* kernel = nullptr; // Shared, see SharedTables
+        int readIndex = 0;
+        int hopCounter = 0;
+        uint32_t stateGeneration = 0; // See freshState
+        
+        static void buildKernel(Kernel& kernel);
+        void initialize(const Kernel& sharedKernel, const juce::dsp::FFT& sharedFFT);
+        void reset();
+        bool isControlTick() const { return controlCounter <= 0; }
+        void setPartials(const float* amplitudes, int count);
+        float process(float newFrequency);
+        
+        void updateControl(float newFrequency);
+        float processOscillatorBank();
+        float processInverseFFT();
+        void synthesizeFrame(int startOffset);
+        float kernelAt(float binOffset) const;
+        void switchRenderer(bool inverseFFT);
+    };
+    
     // Granular engine
     struct Grain {
         float position = 0.0f;
@@ -210,24 +624,79 @@ private:
     };
     
     // Physical modeling components
-    struct KarplusStrong {
-        std::vector<float> delayLine;
-        int writeIndex = 0;
-        float feedback = 0.99f;
-        float damping = 0.5f;
-        float lastSample = 0.0f;
+    // Bank of two-pole resonators tuned to the eigenfrequencies of a membrane
+    // or plate (see ModeTables.h), struck with a mallet pulse. Modes are laid
+    // out SoA and run through SIMD registers a lane block at a time. The
+    // coefficients only change with pitch, and are retuned at control rate.
+    struct ModalBank {
+        static constexpr int MAX_MODES = 64;
+        static constexpr int LANE_BLOCK = 8;
+        static constexpr int CONTROL_INTERVAL = 32; // Samples between retunes
         
-        void setFrequency(float freq, float sampleRate);
-        float process(float excitation);
+        alignas(32) std::array<float, MAX_MODES> ratio {};      // Eigenfrequency over the lowest mode's
+        alignas(32) std::array<float, MAX_MODES> amplitude {};  // Strike response
+        alignas(32) std::array<float, MAX_MODES> radius {};     // Pole radius, from the mode's decay time
+        alignas(32) std::array<float, MAX_MODES> b1 {};
+        alignas(32) std::array<float, MAX_MODES> b2 {};
+        alignas(32) std::array<float, MAX_MODES> inputGain {};
+        alignas(32) std::array<float, MAX_MODES> y1 {};
+        alignas(32) std::array<float, MAX_MODES> y2 {};
+        int numModes = 0;
+        int numLanes = 0;
+        float tunedFrequency = 0.0f;
+        int controlCounter = 0;
+        int strikePosition = DSPTables::MALLET_LENGTH;
+        float strikeLevel = 0.0f;
+        
+        // Decay is the lowest mode's T60; higher modes shorten by damping per
+        // ratio step
+        void setModes(const float* modeRatios, const float* modeAmplitudes, int count,
+                      float decaySeconds, float damping);
+        void strike(float level);
+        void reset();
+        void tune(float frequency);
+        float process(float frequency);
     };
     
     // Spectral processing components (Vital/Serum inspired)
+    // STFT with 75% overlap-add. A frame is transformed every HOP_SIZE samples
+    // as the stream passes through, so the FFT cost lands evenly instead of
+    // once per host block. Output is delayed by FFT_SIZE samples.
     struct SpectralProcessor {
-        static constexpr int FFT_SIZE = 2048;
-        std::array<float, FFT_SIZE> spectrum;
-        std::array<float, FFT_SIZE> phases;
+        static constexpr int FFT_ORDER = 11;
+        static constexpr int FFT_SIZE = 1 << FFT_ORDER;
+        static constexpr int HOP_SIZE = FFT_SIZE / 4;
+        static constexpr int NUM_BINS = FFT_SIZE / 2 + 1;
+        using Window = std::array<float, FFT_SIZE>;
+        static_assert(FFT_SIZE == DSPTables::SPECTRAL_WINDOW_SIZE);
+        
+        std::array<float, FFT_SIZE> spectrum;   // Morph target (long-term magnitude average)
+        std::array<float, FFT_SIZE> phases;     // Per-bin dispersion offsets
         float morphPosition = 0.0f;
-        float warpAmount = 0.0f;
+        float warpAmount = 0.0f;                // Phase dispersion amount
+        float shiftAmount = 1.0f;               // Harmonic shift ratio
+        
+        const juce::dsp::FFT* fft = nullptr; // Shared by the engine's voices
+        const Window* window = nullptr; // Compile-time table, see DSPTables.h
+        std::array<float, FFT_SIZE> inputFifo;
+        std::array<float, FFT_SIZE> outputAccum;
+        std::array<float, FFT_SIZE * 2> frame;
+        std::array<float, NUM_BINS> magnitudes;
+        std::array<float, NUM_BINS> binPhases;
+        std::array<float, NUM_BINS> shiftedMagnitudes;
+        std::array<float, NUM_BINS> shiftedFrequencies;
+        std::array<float, NUM_BINS> analysisPhases;     // Previous frame, for true bin frequency
+        std::array<float, NUM_BINS> synthesisPhases;    // Accumulated output phase when shifting
+        int fifoIndex = 0;
+        int hopCounter = 0;
+        int hopOffset = 0;                      // Where in the hop the first frame falls
+        uint32_t stateGeneration = 0;           // See freshState
+        float dispersionTableAmount = 0.0f;
+        
+        void initialize(const Window& sharedWindow, const juce::dsp::FFT& sharedFFT, int frameOffset);
+        void clear();
+        float process(float input);
+        void processFrame();
         
         void processSpectralMorph(float* buffer, int size, float morph);
         void applyPhaseDispersion(float amount);
@@ -263,69 +732,229 @@ private:
         std::pair<float, float> process(float input);
     };
     
+    // Four allpass delay lines with Householder feedback between them, for
+    // Solar Wind's wash. The lines sit in the lanes of one SIMD register;
+    // only the delay reads and writes are per line. Freezing cuts the input
+    // and makes the loop lossless, so the spectrum the network holds
+    // sustains until it is released. Each voice has its own network.
+    struct DiffusionNetwork {
+        static constexpr int LINES = 4;
+        static constexpr int LINE_LENGTH = 512;
+        static constexpr std::array<int, LINES> delays { 331, 419, 467, 503 }; // Mutually prime
+        using Lanes = std::array<float, LINES>;
+        
+        std::array<float, LINES * LINE_LENGTH> lines {};
+        alignas(16) Lanes feedback {};  // Mixed, damped outputs re-entering the lines
+        std::array<int, LINES> writeIndex {};
+        float diffusion = 0.6f;         // Allpass coefficient
+        float decay = 0.93f;            // Loop gain per pass
+        float brightness = 0.5f;        // Loop lowpass coefficient
+        float freezeAmount = 0.0f;      // Glides towards frozen
+        uint32_t stateGeneration = 0;   // See freshState
+        
+        void reset();
+        StereoFrame<float> process(float input, bool frozen);
+    };
+    
+    // Linkwitz-Riley crossover into 2 or 3 bands, each saturated and
+    // compressed before the bands are summed back. Every band runs the same
+    // chain of biquads with its own coefficients, so the bands sit in the
+    // lanes of one SIMD register. The 4th-order split sums flat; with 3 bands
+    // the low band also passes the upper crossover's allpass to stay in phase.
+    // Compressor gains are recomputed once per control interval.
+    struct MultibandDynamics {
+        static constexpr int LANES = 4;
+        static constexpr int NUM_SECTIONS = 4;
+        static constexpr int CONTROL_INTERVAL = 32;
+        using Lanes = std::array<float, LANES>;
+        
+        enum Response { Silent, Identity, Lowpass, Highpass, Allpass };
+        
+        // Transposed direct form II, one coefficient set per band
+        struct Section {
+            alignas(16) Lanes b0 {};
+            alignas(16) Lanes b1 {};
+            alignas(16) Lanes b2 {};
+            alignas(16) Lanes a1 {};
+            alignas(16) Lanes a2 {};
+            alignas(16) Lanes s1 {};
+            alignas(16) Lanes s2 {};
+        };
+        
+        std::array<Section, NUM_SECTIONS> sections;
+        alignas(16) Lanes drive {};     // Into the saturator
+        alignas(16) Lanes makeup {};    // Undoes the drive and sets the band's level
+        alignas(16) Lanes envelope {};  // Peak, instant attack
+        alignas(16) Lanes gain {};
+        alignas(16) Lanes gainStep {};
+        Lanes threshold {};
+        Lanes ratio {};
+        float release = 0.999f;
+        int controlCounter = 0;
+        
+        void setCrossover(int numBands, float lowFrequency, float highFrequency);
+        void setBand(int band, float bandDrive, float bandThreshold, float bandRatio, float level);
+        void setRelease(float seconds);
+        void setSection(int section, int band, Response response, float frequency);
+        void reset();
+        void updateGains();
+        float process(float input);
+    };
+    
+    // Read-only tables that need runtime numerics, built by the first engine
+    // in the process and shared by every engine after it. Tables that can be
+    // generated at compile time live in DSPTables.h instead.
+    struct SharedTables {
+        std::array<AntiderivativeTable, NumShapers> shaperTables;
+        AdditiveOscillator::Kernel additiveKernel;
+        MinBlep::Table minBlep;
+        
+        SharedTables();
+    };
+    
+    // Per-mode delay memory carved out of one aligned block allocated with the
+    // engine. Regions are zeroed lazily: invalidate() only bumps the generation
+    // and a region clears itself the first time a mode acquires it afterwards.
+    struct ModeStateArena {
+        enum Region
+        {
+            CombRegion = 0,
+            CrystalPitchRegion,
+            NumRegions
+        };
+        
+        static constexpr int ALIGNMENT = 16; // Floats, one 64-byte cache line
+        static constexpr std::array<int, NumRegions> regionSizes { 256, 2048 };
+        
+        std::vector<float> storage;
+        float* base = nullptr;
+        std::array<int, NumRegions> offsets {};
+        std::array<uint32_t, NumRegions> regionGeneration {};
+        uint32_t generation = 1;
+        
+        void allocate();
+        void invalidate() { if (++generation == 0) ++generation; } // 0 marks fresh state
+        float* acquire(Region region);
+    };
+    
     // Synthesis state
     std::array<Layer, 4> layers;
+    std::array<UnisonOscillator, MAX_VOICES> unison;
+    std::array<SyncOscillator, MAX_VOICES> syncOscillators; // Quantum Flux
+    std::array<CrossFMCore, MAX_VOICES> plasmaCores;
+    std::array<BassVoice, MAX_VOICES> bassVoices;  // Liquid Bass
     std::array<Filter, 4> filters;
+    Filter silkSideFormant;
     std::array<Envelope, 4> envelopes;
     std::array<LFO, 4> lfos;
     std::array<FMOperator, 6> fmOperators;
-    std::array<Harmonic, 32> harmonics;
+    std::array<FMVoice, MAX_VOICES> fmVoices;
+    int fmAlgorithm = 0;
+    std::array<Harmonic, AdditiveOscillator::MAX_PARTIALS> harmonics;
+    std::unique_ptr<std::array<AdditiveOscillator, MAX_VOICES>> additiveVoices; // Nebula Drift
     std::array<Grain, 32> grains;
-    std::array<KarplusStrong, 4> strings;
+    LadderFilterBank voiceLadders;
+    juce::SharedResourcePointer<SharedTables> sharedTables;
+    std::array<std::array<ShaperStage, NumShaperSlots>, MAX_VOICES> shaperStages;
+    std::array<int, NumModes> modeAntiAliasing {};
     
     WavetableOscillator wavetable;
     Chorus chorus;
-    Reverb reverb;
-    DelayLine delay;
+    Reverb<double> reverb;
+    DelayLine<double> delay;
+    
+    // Master stereo chain, separate from the effects the modes play through
+    Chorus masterChorusLeft;
+    Chorus masterChorusRight;
+    DelayLine<StereoFrame<double>> masterDelay;
+    Reverb<StereoFrame<double>> masterReverb;
     
     // Advanced processing (for futuristic modes)
-    SpectralProcessor spectralProc;
+    std::unique_ptr<std::array<SpectralProcessor, MAX_VOICES>> spectralVoices; // Nebula Drift
+    
+    // Nebula Drift's FFTs, shared by its voices. One per engine rather than
+    // per process: an engine renders on one thread, but some FFT backends
+    // use scratch space inside perform.
+    std::unique_ptr<juce::dsp::FFT> additiveFFT;
+    std::unique_ptr<juce::dsp::FFT> spectralFFT;
+    
     Phaser phaser;
     BitCrusher bitCrusher;
-    DimensionExpander dimension;
-    
-    // Grain buffer for Cloud Nine
-    std::vector<float> grainBuffer;
+    std::unique_ptr<DimensionExpander> dimension; // Void Resonance
+    std::unique_ptr<std::array<MultibandDynamics, MAX_VOICES>> voidMultiband; // Void Resonance
+    std::unique_ptr<std::array<DiffusionNetwork, MAX_VOICES>> solarDiffusion; // Solar Wind
+    using ModalVoices = std::array<ModalBank, MAX_VOICES>;
+    std::unique_ptr<ModalVoices> crystallineModes;   // Membrane
+    std::unique_ptr<ModalVoices> crystalMatrixModes; // Plate
+    
+    // Unison settings, shared by every voice
+    int unisonSubVoices = 0;
+    float unisonDetune = 0.0f;
+    float unisonSpread = 0.0f;
+    float unisonPhaseRandomness = 1.0f;
+    
+    // Grain state for Cloud Nine
     int grainCounter = 0;
     
     // State tracking
+    float sampleRate = 44100.0f;  // Host rate; see setSampleRate
     float velocity = 0.7f;
     float lastFrequency = 440.0f;
     float currentPhase = 0.0f;
     int sampleCounter = 0;
+    int currentVoice = 0;
+    int currentMode = 0;
     
     // Effects mix levels
     float reverbMixLevel = 0.0f;
     float chorusMixLevel = 0.0f;
     float delayMixLevel = 0.0f;
     
-    // Per-mode state (to prevent static variable issues)
+    // Per-mode state (to prevent static variable issues). The buffers live in
+    // modeArena; only their cursors are kept here.
+    ModeStateArena modeArena;
     float plasmaCoreBuffer = 0.0f;
-    std::array<float, 256> combBuffer = {0};
     int combIndex = 0;
-    float quantumSyncPhase = 0.0f;
     float quantumFrozenSample = 0.0f;
-    std::array<float, 2048> crystalPitchBuffer = {0};
     int crystalPitchIndex = 0;
-    std::array<float, 32> solarFrozenSpectrum = {0};
-    std::array<std::array<float, 512>, 4> solarDiffusionBuffer = {{0}};
-    std::array<int, 4> solarDiffusionIndex = {0};
+    bool solarFrozen = false;
+    
+    // Generation stamps for the larger mode state. Per-mode allocations carry
+    // their own, so a freshly prepared mode is known to be clean.
+    uint32_t reverbGeneration = 0;
+    uint32_t delayGeneration = 0;
+    std::array<std::array<uint32_t, NumShaperSlots>, MAX_VOICES> shaperGeneration {};
+    bool modeStateUsed = true;  // Rendered since the last retire
+    int scrubIndex = 0;
+    uint32_t renderModes = ~0u;
+    
+    bool rendersMode(int modeIndex) const { return (renderModes & (1u << modeIndex)) != 0; }
+    void resetModeAllocations(uint32_t modeMask);
     
     // Random number generator
     std::mt19937 rng;
     std::uniform_real_distribution<float> randomDist;
     
     // Helper functions
-    float softClip(float input);
-    float hardClip(float input);
-    float analogSaturate(float input);
+    static float analogSaturate(float input);
+    float shape(int slot, int type, float input);
+    template <typename State> State& freshState(State& state, uint32_t& stamp);
     float randomFloat();
+    static float fastSin(float cycles);
+    static float polyBlep(float t, float dt);
+    static float polyBlepPulse(float t, float dt, float width);
     void triggerGrain();
     void updateHarmonics(float frequency, int mode);
     float mixLayers(float dry, float wet, float mix);
     float spectralWarp(float value, float warp);
+    
+    template <int Mode> static forcedinline float driveShape(float x);
+    template <int Mode> static forcedinline float ladderTick(float input, float G, float k,
+                                                             float& s1, float& s2, float& s3, float& s4);
     void applyShepardTone(float* harmonics, int numHarmonics, float position);
     
     // Mode information table
     static const std::array<ModeInfo, NumModes> modeInfoTable;
+    static const std::array<FMAlgorithm, 5> fmAlgorithmTable;
+    static const std::array<int, NumModes> defaultAntiAliasing;
 };
\ No newline at end of file
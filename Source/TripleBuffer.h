@@ -0,0 +1,52 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+// Single-writer, single-reader handoff of a value the reader must never wait
+// for. The writer fills its private slot and publishes it; the reader takes
+// the newest published slot. An unread value is replaced by a newer one.
+// Neither side locks or allocates.
+template <typename T>
+class TripleBuffer
+{
+public:
+    // Set every slot before the buffer is shared between threads
+    void fill(const T& value)
+    {
+        for (auto& slot : slots)
+        {
+            slot = value;
+        }
+    }
+
+    // Writer
+    T& getWriteBuffer() { return slots[backSlot]; }
+
+    void publish()
+    {
+        backSlot = pendingSlot.exchange(backSlot | dirtyBit, std::memory_order_acq_rel) & slotMask;
+    }
+
+    // Reader. Returns true if a new value was taken.
+    bool update()
+    {
+        if ((pendingSlot.load(std::memory_order_relaxed) & dirtyBit) == 0)
+            return false;
+
+        frontSlot = pendingSlot.exchange(frontSlot, std::memory_order_acq_rel) & slotMask;
+        return true;
+    }
+
+    const T& getReadBuffer() const { return slots[frontSlot]; }
+
+private:
+    // The writer owns backSlot and the reader owns frontSlot; they trade
+    // through pendingSlot, whose dirty bit marks an unread value
+    static constexpr int slotMask = 3;
+    static constexpr int dirtyBit = 4;
+    std::array<T, 3> slots;
+    int backSlot = 0;
+    int frontSlot = 1;
+    std::atomic<int> pendingSlot{2};
+};
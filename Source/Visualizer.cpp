@@ -5,10 +5,6 @@
 CymaglyphVisualizer::CymaglyphVisualizer(juce::AudioProcessorValueTreeState& apvts)
     : parameters(apvts)
 {
-    // Initialize mode tables
-    squareModes = CymaglyphModes::getSquareModes();
-    circularModes = CymaglyphModes::getCircularModes();
-    
     // Make component non-opaque to ensure it renders
     setOpaque(false);
     
@@ -124,14 +120,14 @@ void CymaglyphVisualizer::updateModeParameters(float frequency)
 {
     // Always use square modes for v2
     float rank = CymaglyphModes::frequencyToModeRank(frequency);
-    auto modePair = CymaglyphModes::getModePair(squareModes, rank);
+    auto modePair = CymaglyphModes::getModePair(CymaglyphModes::squareModeTable, rank);
     
     modeParams.mode1_m = modePair.first.m;
     modeParams.mode1_n = modePair.first.n;
     modeParams.mode2_m = modePair.second.m;
     modeParams.mode2_n = modePair.second.n;
     
-    modeParams.modeCrossfade = CymaglyphModes::getModeCrossfade(rank, squareModes.size());
+    modeParams.modeCrossfade = CymaglyphModes::getModeCrossfade(rank, CymaglyphModes::NUM_SQUARE_MODES);
     
     // Edge clamped by default
     modeParams.mode1_weight = 1.0f;
@@ -54,10 +54,6 @@ private:
     std::atomic<float> targetFrequency{440.0f};
     float currentTime = 0.0f;
     
-    // Mode data
-    std::vector<CymaglyphModes::SquareMode> squareModes;
-    std::vector<CymaglyphModes::CircularMode> circularModes;
-    
     // Current mode parameters
     struct ModeParams {
         // Square/Circle modes